@@ -0,0 +1,1314 @@
+/************************************************************************************
+ * @file BenchJsonWrapper.cpp
+ * @brief Throughput benchmarks for every `Wrappers::IJsonWrapper` implementation.
+ * @note Corpus files (twitter.json, citm_catalog.json, canada.json) are read from
+ *       `UNIFIED_JSON_WRAPPER_BENCH_DATA_DIR`; missing files are reported as skipped.
+ ************************************************************************************/
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Exceptions/XJsonError.hpp"
+#include "Implementations/NlohmannJsonWrapper.hpp"
+#include "Implementations/SimdJsonWrapper.hpp"
+#include "Interfaces/IJsonWrapper.hpp"
+#include "Interfaces/JsonBatch.hpp"
+#include "Interfaces/JsonBinaryFormat.hpp"
+#include "Interfaces/JsonBinding.hpp"
+#include "Interfaces/JsonDocument.hpp"
+#include "Interfaces/JsonDocumentCache.hpp"
+#include "Interfaces/JsonFeedParser.hpp"
+#include "Interfaces/JsonKey.hpp"
+#include "Interfaces/JsonPath.hpp"
+#include "Interfaces/JsonStream.hpp"
+#include "Interfaces/JsonView.hpp"
+#include "Interfaces/JsonWriter.hpp"
+
+// #region Bound_Structs
+
+/**
+ * @brief The nested object of the generated message.
+ */
+struct BenchMeta
+{
+    std::string region;
+    int32_t retries{0};
+};
+
+template<>
+struct Wrappers::JsonBinding<BenchMeta>
+{
+    static constexpr auto fields =
+        std::make_tuple(Wrappers::Field("region", &BenchMeta::region), Wrappers::Field("retries", &BenchMeta::retries));
+};
+
+/**
+ * @brief The named fields of the generated message; the `field_<n>` members are skipped.
+ */
+struct BenchMessage
+{
+    int64_t id{0};
+    std::string userId;
+    int64_t timestamp{0};
+    double score{0.0};
+    bool active{false};
+    std::vector<std::string> tags;
+    BenchMeta meta;
+};
+
+template<>
+struct Wrappers::JsonBinding<BenchMessage>
+{
+    static constexpr auto fields = std::make_tuple(Wrappers::Field("id", &BenchMessage::id),
+                                                   Wrappers::Field("user_id", &BenchMessage::userId),
+                                                   Wrappers::Field("timestamp", &BenchMessage::timestamp),
+                                                   Wrappers::Field("score", &BenchMessage::score),
+                                                   Wrappers::Field("active", &BenchMessage::active),
+                                                   Wrappers::Field("tags", &BenchMessage::tags),
+                                                   Wrappers::Field("meta", &BenchMessage::meta));
+};
+
+// #endregion
+
+// #region Allocation_Counting
+
+namespace
+{
+    /**
+     * @brief Number of calls to the global `operator new` since program start.
+     */
+    std::atomic<uint64_t> allocationCount{0};
+
+    void* CountedAllocate(std::size_t size)
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+        void* memory = std::malloc(0 == size ? 1 : size);
+        if (nullptr == memory)
+        {
+            throw std::bad_alloc{};
+        }
+
+        return memory;
+    }
+
+    /**
+     * @brief Same as above for over-aligned requests, which is how `std::pmr::new_delete_resource()` allocates.
+     */
+    void* CountedAllocate(std::size_t size, std::align_val_t alignment)
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+        // `aligned_alloc()` wants a multiple of the alignment
+        const auto align = static_cast<std::size_t>(alignment);
+        void* memory = std::aligned_alloc(align, (0 == size) ? align : (size + align - 1) / align * align);
+        if (nullptr == memory)
+        {
+            throw std::bad_alloc{};
+        }
+
+        return memory;
+    }
+
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    return CountedAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return CountedAllocate(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t /*size*/) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t /*size*/) noexcept
+{
+    std::free(memory);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, alignment);
+}
+
+void operator delete(void* memory, std::align_val_t /*alignment*/) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t /*alignment*/) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept
+{
+    std::free(memory);
+}
+
+// #endregion
+
+namespace
+{
+    /**
+     * @brief Type list of all the implementations of `Wrappers::IJsonWrapper` that are to be benchmarked.
+     * @note Keep in sync with `TestTypes` in Tests/TestJsonWrapper.cpp.
+     */
+    template<typename... TJsonWrapperImpls>
+    struct BackendList
+    {
+    };
+
+    using BenchmarkTypes = BackendList<Wrappers::NlohmannJsonWrapper,
+                                       Wrappers::NlohmannFlatJsonWrapper,
+                                       Wrappers::NlohmannPmrJsonWrapper,
+                                       Wrappers::SimdJsonWrapper>;
+
+    template<typename TJsonWrapperImpl>
+    const char* BackendName();
+
+    template<>
+    const char* BackendName<Wrappers::NlohmannJsonWrapper>()
+    {
+        return "NlohmannJson";
+    }
+
+    template<>
+    const char* BackendName<Wrappers::NlohmannFlatJsonWrapper>()
+    {
+        return "NlohmannFlatJson";
+    }
+
+    template<>
+    const char* BackendName<Wrappers::NlohmannPmrJsonWrapper>()
+    {
+        return "NlohmannPmrJson";
+    }
+
+    template<>
+    const char* BackendName<Wrappers::SimdJsonWrapper>()
+    {
+        return "SimdJson";
+    }
+
+    /**
+     * @brief Standard corpora, plus a generated message that is always available.
+     */
+    const std::vector<std::string> corpusNames = {"twitter.json", "citm_catalog.json", "canada.json", "message.json"};
+
+    constexpr int kFieldCount = 16;
+    constexpr int kNestingDepth = 5;
+    constexpr int kSampleCount = 1024;
+    constexpr int kStreamDocumentCount = 1000;
+    constexpr int kMissingFieldCount = 7;
+    constexpr std::size_t kArenaSize = 64 * 1024;
+    constexpr int kRoutedItemCount = 400;
+    constexpr std::size_t kBatchDocumentCount = 10000;
+
+    /**
+     * @brief A typical small service message: flat scalars, one nested object and a short array.
+     */
+    std::string GenerateMessage()
+    {
+        std::ostringstream message;
+        message << R"({"id":123456789,"user_id":"u-5f2c9a","timestamp":1718000000123,"score":0.875,)"
+                << R"("active":true,"tags":["alpha","beta","gamma"],"meta":{"region":"eu-west-1","retries":2},)";
+        for (int i = 0; i < kFieldCount; ++i)
+        {
+            message << R"("field_)" << i << R"(":)" << i * 31 << ',';
+        }
+        message << R"("note":null})";
+
+        return message.str();
+    }
+
+    /**
+     * @brief A request body of about 50 KB, of which a router reads only the small header members.
+     */
+    std::string GenerateRoutedMessage()
+    {
+        std::ostringstream message;
+        message << R"({"route":"orders.create","tenant":"t-42","version":3,"payload":{"items":[)";
+        for (int i = 0; i < kRoutedItemCount; ++i)
+        {
+            message << (0 == i ? "" : ",") << R"({"sku":"SKU-)" << i << R"(","quantity":)" << i % 7 + 1
+                    << R"(,"price":)" << i * 0.25 << R"(,"tags":["new","sale"],"note":"item \")" << i << R"(\""})";
+        }
+        message << R"(]}})";
+
+        return message.str();
+    }
+
+    /**
+     * @brief Load a corpus once and keep it for the remaining benchmarks.
+     * @return The document, or an empty string if the file is missing.
+     */
+    const std::string& LoadCorpus(const std::string& name)
+    {
+        static std::vector<std::pair<std::string, std::string>> cache;
+        for (const auto& [cachedName, content] : cache)
+        {
+            if (cachedName == name)
+            {
+                return content;
+            }
+        }
+
+        std::string content;
+        if ("message.json" == name)
+        {
+            content = GenerateMessage();
+        }
+        else
+        {
+            std::ifstream file{std::string{UNIFIED_JSON_WRAPPER_BENCH_DATA_DIR} + "/" + name,
+                               std::ios::binary | std::ios::ate};
+            if (file)
+            {
+                content.resize(static_cast<std::size_t>(file.tellg()));
+                file.seekg(0);
+                file.read(content.data(), static_cast<std::streamsize>(content.size()));
+            }
+        }
+
+        cache.emplace_back(name, std::move(content));
+        return cache.back().second;
+    }
+
+    /**
+     * @brief Report allocations per iteration since `startCount`.
+     */
+    void ReportAllocations(benchmark::State& state, uint64_t startCount)
+    {
+        const uint64_t allocations = allocationCount.load(std::memory_order_relaxed) - startCount;
+        state.counters["allocs/op"] =
+            benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+    }
+
+    std::vector<std::string> FieldKeys()
+    {
+        std::vector<std::string> keys;
+        for (int i = 0; i < kFieldCount; ++i)
+        {
+            keys.push_back("field_" + std::to_string(i));
+        }
+
+        return keys;
+    }
+
+    // #region Benchmarks
+
+    template<typename TJsonWrapperImpl>
+    void BenchParse(benchmark::State& state, const std::string& corpusName)
+    {
+        const std::string& json = LoadCorpus(corpusName);
+        if (json.empty())
+        {
+            state.SkipWithError("corpus file not found");
+            return;
+        }
+
+        TJsonWrapperImpl jsonWrapper;
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            jsonWrapper.Parse(json);
+            benchmark::ClobberMemory();
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(json.size()));
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+     * @brief Parse a corpus pushed through a `JsonFeedParser` in chunks of `state.range(0)` bytes, as read off a
+     *        socket, against `BenchParse()` on the whole text.
+     */
+    template<typename TJsonWrapperImpl>
+    void BenchFeed(benchmark::State& state, const std::string& corpusName)
+    {
+        const std::string& json = LoadCorpus(corpusName);
+        if (json.empty())
+        {
+            state.SkipWithError("corpus file not found");
+            return;
+        }
+
+        const std::size_t chunkSize = static_cast<std::size_t>(state.range(0));
+
+        TJsonWrapperImpl jsonWrapper;
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            Wrappers::JsonFeedParser parser{jsonWrapper};
+            for (std::size_t offset = 0; offset < json.size(); offset += chunkSize)
+            {
+                parser.Feed(std::string_view{json}.substr(offset, chunkSize));
+            }
+            parser.Finish();
+            benchmark::ClobberMemory();
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(json.size()));
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+     * @brief Parse a large body and read three header members, with `Parse()` or `ParseLazy()`.
+     */
+    template<typename TJsonWrapperImpl>
+    void BenchRoute(benchmark::State& state, bool lazy)
+    {
+        const std::string json = GenerateRoutedMessage();
+
+        TJsonWrapperImpl jsonWrapper;
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            if (lazy)
+            {
+                jsonWrapper.ParseLazy(json);
+            }
+            else
+            {
+                jsonWrapper.Parse(json);
+            }
+            benchmark::DoNotOptimize(jsonWrapper.GetStringView("route"));
+            benchmark::DoNotOptimize(jsonWrapper.GetStringView("tenant"));
+            benchmark::DoNotOptimize(jsonWrapper.GetInt("version"));
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(json.size()));
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+     * @brief Send a message from one service to another: encode it as text or CBOR, then decode the payload.
+     * @note The `payload` counter is the size of what goes over the wire.
+     */
+    template<typename TJsonWrapperImpl>
+    void BenchHop(benchmark::State& state, bool binary)
+    {
+        TJsonWrapperImpl sender;
+        sender.Parse(LoadCorpus("message.json"));
+
+        TJsonWrapperImpl receiver;
+        std::string text;
+        std::size_t payload = 0;
+        for (auto _ : state)
+        {
+            if (binary)
+            {
+                const std::vector<std::uint8_t> bytes = sender.ToBinary(Wrappers::JsonBinaryFormat::Cbor);
+                receiver.ParseBinary(Wrappers::JsonBinaryFormat::Cbor, bytes.data(), bytes.size());
+                payload = bytes.size();
+            }
+            else
+            {
+                sender.SerializeTo(text);
+                receiver.Parse(text);
+                payload = text.size();
+            }
+            benchmark::DoNotOptimize(receiver.HasKey("id"));
+        }
+
+        state.counters["payload"] = static_cast<double>(payload);
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+     * @brief Look up a document in a cache shared by the benchmark threads, as workers parsing the same config do.
+     * @note Registered only for backends whose documents allow concurrent reads.
+     *       Compare with `Parse/<backend>/message.json`.
+     */
+    template<typename TJsonWrapperImpl>
+    void BenchCachedParse(benchmark::State& state)
+    {
+        static Wrappers::JsonDocumentCache cache{[] { return std::make_unique<TJsonWrapperImpl>(); }};
+        const std::string& json = LoadCorpus("message.json");
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(cache.Parse(json));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(json.size()));
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+     * @brief Parse a batch of messages with `ParseBatch()` on `state.range(0)` threads.
+     */
+    template<typename TJsonWrapperImpl>
+    void BenchParseBatch(benchmark::State& state)
+    {
+        const std::string& json = LoadCorpus("message.json");
+        const std::vector<std::string_view> documents(kBatchDocumentCount, json);
+
+        Wrappers::JsonBatchOptions options;
+        options.threadCount = static_cast<std::size_t>(state.range(0));
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Wrappers::ParseBatch([] { return std::make_unique<TJsonWrapperImpl>(); },
+                                                          documents.data(),
+                                                          documents.size(),
+                                                          options));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(json.size() * kBatchDocumentCount));
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchDocumentCount));
+    }
+
+    template<typename TJsonWrapperImpl>
+    void BenchParseFile(benchmark::State& state, const std::string& corpusName)
+    {
+        const std::string& json = LoadCorpus(corpusName);
+        if (json.empty())
+        {
+            state.SkipWithError("corpus file not found");
+            return;
+        }
+
+        const std::string filePath = std::string{UNIFIED_JSON_WRAPPER_BENCH_DATA_DIR} + "/" + corpusName;
+        TJsonWrapperImpl jsonWrapper;
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            jsonWrapper.ParseFile(filePath);
+            benchmark::ClobberMemory();
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(json.size()));
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template<typename TJsonWrapperImpl>
+    void BenchToString(benchmark::State& state, const std::string& corpusName)
+    {
+        const std::string& json = LoadCorpus(corpusName);
+        if (json.empty())
+        {
+            state.SkipWithError("corpus file not found");
+            return;
+        }
+
+        TJsonWrapperImpl jsonWrapper;
+        jsonWrapper.Parse(json);
+
+        int64_t bytes = 0;
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            const std::string serialized = jsonWrapper.ToString();
+            bytes += static_cast<int64_t>(serialized.size());
+            benchmark::DoNotOptimize(serialized.data());
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetBytesProcessed(bytes);
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template<typename TJsonWrapperImpl>
+    void BenchSerializeTo(benchmark::State& state, const std::string& corpusName)
+    {
+        const std::string& json = LoadCorpus(corpusName);
+        if (json.empty())
+        {
+            state.SkipWithError("corpus file not found");
+            return;
+        }
+
+        TJsonWrapperImpl jsonWrapper;
+        jsonWrapper.Parse(json);
+
+        int64_t bytes = 0;
+        std::string serialized;
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            jsonWrapper.SerializeTo(serialized);
+            bytes += static_cast<int64_t>(serialized.size());
+            benchmark::DoNotOptimize(serialized.data());
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetBytesProcessed(bytes);
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+     * @brief Serialize a corpus with `SerializeParallel()` on `state.range(0)` threads.
+     */
+    template<typename TJsonWrapperImpl>
+    void BenchSerializeParallel(benchmark::State& state, const std::string& corpusName)
+    {
+        const std::string& json = LoadCorpus(corpusName);
+        if (json.empty())
+        {
+            state.SkipWithError("corpus file not found");
+            return;
+        }
+
+        TJsonWrapperImpl jsonWrapper;
+        jsonWrapper.Parse(json);
+
+        int64_t bytes = 0;
+        std::string serialized;
+        for (auto _ : state)
+        {
+            jsonWrapper.SerializeParallel(serialized, static_cast<std::size_t>(state.range(0)));
+            bytes += static_cast<int64_t>(serialized.size());
+            benchmark::DoNotOptimize(serialized.data());
+        }
+
+        state.SetBytesProcessed(bytes);
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template<typename TJsonWrapperImpl>
+    void BenchSetScalars(benchmark::State& state)
+    {
+        const std::vector<std::string> keys = FieldKeys();
+
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            TJsonWrapperImpl jsonWrapper;
+            for (int i = 0; i < kFieldCount; i += 4)
+            {
+                jsonWrapper.SetInt(keys[static_cast<std::size_t>(i)], i);
+                jsonWrapper.SetDouble(keys[static_cast<std::size_t>(i + 1)], i * 0.5);
+                jsonWrapper.SetString(keys[static_cast<std::size_t>(i + 2)], "value");
+                jsonWrapper.SetBool(keys[static_cast<std::size_t>(i + 3)], true);
+            }
+            benchmark::ClobberMemory();
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations() * kFieldCount);
+    }
+
+    template<typename TJsonWrapperImpl>
+    void BenchRespondDom(benchmark::State& state)
+    {
+        const std::vector<std::string> keys = FieldKeys();
+
+        std::string response;
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            TJsonWrapperImpl jsonWrapper;
+            for (int i = 0; i < kFieldCount; i += 4)
+            {
+                jsonWrapper.SetInt(keys[static_cast<std::size_t>(i)], i);
+                jsonWrapper.SetDouble(keys[static_cast<std::size_t>(i + 1)], i * 0.5);
+                jsonWrapper.SetString(keys[static_cast<std::size_t>(i + 2)], "value");
+                jsonWrapper.SetBool(keys[static_cast<std::size_t>(i + 3)], true);
+            }
+
+            std::unique_ptr<Wrappers::IJsonWrapper> meta = jsonWrapper.GetEmptyObject();
+            meta->SetString("status", "ok");
+            meta->SetInt("version", 3);
+            jsonWrapper.SetObject("meta", std::move(meta));
+
+            jsonWrapper.SerializeTo(response);
+            benchmark::DoNotOptimize(response.data());
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+     * @brief Same response as `BenchRespondDom()`, written without a tree.
+     */
+    void BenchRespondWriter(benchmark::State& state)
+    {
+        const std::vector<std::string> keys = FieldKeys();
+
+        std::string response;
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            response.clear();
+            Wrappers::JsonWriter writer{response};
+            writer.BeginObject();
+            for (int i = 0; i < kFieldCount; i += 4)
+            {
+                writer.Key(keys[static_cast<std::size_t>(i)]);
+                writer.Int(i);
+                writer.Key(keys[static_cast<std::size_t>(i + 1)]);
+                writer.Double(i * 0.5);
+                writer.Key(keys[static_cast<std::size_t>(i + 2)]);
+                writer.String("value");
+                writer.Key(keys[static_cast<std::size_t>(i + 3)]);
+                writer.Bool(true);
+            }
+
+            writer.Key("meta");
+            writer.BeginObject();
+            writer.Key("status");
+            writer.String("ok");
+            writer.Key("version");
+            writer.Int(3);
+            writer.EndObject();
+            writer.EndObject();
+
+            writer.Finish();
+            benchmark::DoNotOptimize(response.data());
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+     * @brief Set a parsed document of another backend as a member, converted by `SetObject()` from its events or,
+     *        with `roundTrip`, serialized and parsed again by the caller.
+     * @note Both include parsing the source, so that each iteration has a fresh child to give away.
+     */
+    template<typename TJsonWrapperImpl>
+    void BenchAdopt(benchmark::State& state, bool roundTrip)
+    {
+        using TSource = std::conditional_t<std::is_same_v<TJsonWrapperImpl, Wrappers::NlohmannJsonWrapper>,
+                                           Wrappers::SimdJsonWrapper,
+                                           Wrappers::NlohmannJsonWrapper>;
+
+        const std::string message = GenerateMessage();
+
+        TJsonWrapperImpl jsonWrapper;
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            auto child = std::make_unique<TSource>();
+            child->Parse(message);
+            if (roundTrip)
+            {
+                auto copy = std::make_unique<TJsonWrapperImpl>();
+                copy->Parse(child->ToString());
+                jsonWrapper.SetObject("child", std::move(copy));
+            }
+            else
+            {
+                jsonWrapper.SetObject("child", std::unique_ptr<Wrappers::IJsonWrapper>{std::move(child)});
+            }
+            benchmark::ClobberMemory();
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    template<typename TJsonWrapperImpl>
+    void BenchGetScalars(benchmark::State& state)
+    {
+        const std::vector<std::string> keys = FieldKeys();
+
+        TJsonWrapperImpl jsonWrapper;
+        jsonWrapper.Parse(LoadCorpus("message.json"));
+
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            for (const std::string& key : keys)
+            {
+                benchmark::DoNotOptimize(jsonWrapper.GetInt(key));
+            }
+            benchmark::DoNotOptimize(jsonWrapper.GetString("user_id"));
+            benchmark::DoNotOptimize(jsonWrapper.GetDouble("score"));
+            benchmark::DoNotOptimize(jsonWrapper.GetBool("active"));
+            benchmark::DoNotOptimize(jsonWrapper.HasKey("missing"));
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations() * (kFieldCount + 4));
+    }
+
+    /**
+     * @brief The reads of `BenchGetScalars()` through `JsonKey` handles created up front.
+     * @note The nlohmann backends look the keys up by name, so they should match `GetScalars/<backend>`.
+     */
+    template<typename TJsonWrapperImpl>
+    void BenchGetScalarsByKey(benchmark::State& state)
+    {
+        std::vector<Wrappers::JsonKey> keys;
+        for (const std::string& key : FieldKeys())
+        {
+            keys.emplace_back(key);
+        }
+        const Wrappers::JsonKey userId{"user_id"};
+        const Wrappers::JsonKey score{"score"};
+        const Wrappers::JsonKey active{"active"};
+        const Wrappers::JsonKey missing{"missing"};
+
+        TJsonWrapperImpl jsonWrapper;
+        jsonWrapper.Parse(LoadCorpus("message.json"));
+
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            for (const Wrappers::JsonKey& key : keys)
+            {
+                benchmark::DoNotOptimize(jsonWrapper.GetInt(key));
+            }
+            benchmark::DoNotOptimize(jsonWrapper.GetString(userId));
+            benchmark::DoNotOptimize(jsonWrapper.GetDouble(score));
+            benchmark::DoNotOptimize(jsonWrapper.GetBool(active));
+            benchmark::DoNotOptimize(jsonWrapper.HasKey(missing));
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations() * (kFieldCount + 4));
+    }
+
+    /**
+     * @brief The reads of `BenchGetScalars()`, on an `IJsonWrapper` or a `JsonDocument`.
+     */
+    template<typename TDocument>
+    void ExtractFields(const TDocument& document, const std::vector<std::string>& keys)
+    {
+        for (const std::string& key : keys)
+        {
+            benchmark::DoNotOptimize(document.GetInt(key));
+        }
+        benchmark::DoNotOptimize(document.GetStringView("user_id"));
+        benchmark::DoNotOptimize(document.GetDouble("score"));
+        benchmark::DoNotOptimize(document.GetBool("active"));
+        benchmark::DoNotOptimize(document.HasKey("missing"));
+    }
+
+    /**
+     * @brief Field extraction dispatched through the vtable or statically.
+     * @param dynamicDispatch Read through an `IJsonWrapper` whose backend the compiler cannot see, rather than
+     *        through `JsonDocument`.
+     */
+    template<typename TJsonWrapperImpl>
+    void BenchExtract(benchmark::State& state, bool dynamicDispatch)
+    {
+        const std::vector<std::string> keys = FieldKeys();
+
+        Wrappers::JsonDocument<TJsonWrapperImpl> document;
+        document.Parse(LoadCorpus("message.json"));
+
+        // hide the backend type from the optimizer, as for a wrapper handed over by other code; a volatile pointer
+        // rather than DoNotOptimize(), whose "+m,r" operand GCC 12 drops under link-time optimization
+        const Wrappers::IJsonWrapper* volatile jsonWrapper = &document.Wrapper();
+
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            if (dynamicDispatch)
+            {
+                ExtractFields(*jsonWrapper, keys);
+            }
+            else
+            {
+                ExtractFields(document, keys);
+            }
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations() * (kFieldCount + 4));
+    }
+
+    /**
+     * @brief Fill a `BenchMessage` with one getter per field, or with `DecodeStruct()` in one pass over the members.
+     */
+    template<typename TJsonWrapperImpl>
+    void BenchBind(benchmark::State& state, bool decodeStruct)
+    {
+        TJsonWrapperImpl jsonWrapper;
+        jsonWrapper.Parse(LoadCorpus("message.json"));
+
+        BenchMessage message;
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            if (decodeStruct)
+            {
+                Wrappers::DecodeStruct(jsonWrapper, message);
+            }
+            else
+            {
+                message.id = jsonWrapper.GetInt("id");
+                message.userId = jsonWrapper.GetStringView("user_id");
+                message.timestamp = jsonWrapper.GetInt("timestamp");
+                message.score = jsonWrapper.GetDouble("score");
+                message.active = jsonWrapper.GetBool("active");
+
+                const Wrappers::JsonView tags = jsonWrapper.GetArrayView("tags");
+                message.tags.resize(tags.Size());
+                for (std::size_t i = 0; i < message.tags.size(); ++i)
+                {
+                    message.tags[i] = tags.Element(i).AsStringView();
+                }
+
+                const Wrappers::JsonView meta = jsonWrapper.GetObjectView("meta");
+                message.meta.region = meta.GetStringView("region");
+                message.meta.retries = static_cast<int32_t>(meta.GetInt("retries"));
+            }
+            benchmark::DoNotOptimize(message);
+        }
+        ReportAllocations(state, startCount);
+    }
+
+    /**
+     * @brief Probe the message fields plus about 30% of absent ones, with `GetInt()` and a catch, or `TryGetInt()`.
+     */
+    template<typename TJsonWrapperImpl>
+    void BenchOptionalLookups(benchmark::State& state, bool tryGetters)
+    {
+        std::vector<std::string> keys = FieldKeys();
+        for (int i = 0; i < kMissingFieldCount; ++i)
+        {
+            keys.push_back("optional_" + std::to_string(i));
+        }
+
+        TJsonWrapperImpl jsonWrapper;
+        jsonWrapper.Parse(LoadCorpus("message.json"));
+
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            int64_t sum = 0;
+            for (const std::string& key : keys)
+            {
+                if (tryGetters)
+                {
+                    sum += jsonWrapper.TryGetInt(key).ValueOr(0);
+                    continue;
+                }
+
+                try
+                {
+                    sum += jsonWrapper.GetInt(key);
+                }
+                catch (const Wrappers::XJsonError&)
+                {
+                }
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(keys.size()));
+    }
+
+    template<typename TJsonWrapperImpl>
+    void BenchNestedObjects(benchmark::State& state)
+    {
+        const TJsonWrapperImpl factory;
+
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            std::unique_ptr<Wrappers::IJsonWrapper> current = factory.GetEmptyObject();
+            current->SetInt("leaf", kNestingDepth);
+            for (int depth = 0; depth < kNestingDepth; ++depth)
+            {
+                std::unique_ptr<Wrappers::IJsonWrapper> parent = factory.GetEmptyObject();
+                parent->SetObject("child", std::move(current));
+                current = std::move(parent);
+            }
+
+            for (int depth = 0; depth < kNestingDepth; ++depth)
+            {
+                current = current->GetObject("child");
+            }
+            benchmark::DoNotOptimize(current->GetInt("leaf"));
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations() * kNestingDepth * 2);
+    }
+
+    /**
+     * @brief `{"child":{"child":...{"leaf":N}}}`, `kNestingDepth` levels deep.
+     */
+    std::string GenerateNested()
+    {
+        std::string json = R"({"leaf":)" + std::to_string(kNestingDepth) + "}";
+        for (int depth = 0; depth < kNestingDepth; ++depth)
+        {
+            json = R"({"child":)" + json + "}";
+        }
+
+        return json;
+    }
+
+    template<typename TJsonWrapperImpl>
+    void BenchNestedViews(benchmark::State& state)
+    {
+        TJsonWrapperImpl jsonWrapper;
+        jsonWrapper.Parse(GenerateNested());
+
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            Wrappers::JsonView current = jsonWrapper.View();
+            for (int depth = 0; depth < kNestingDepth; ++depth)
+            {
+                current = current.GetObjectView("child");
+            }
+            benchmark::DoNotOptimize(current.GetInt("leaf"));
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations() * kNestingDepth);
+    }
+
+    template<typename TJsonWrapperImpl>
+    void BenchNestedPath(benchmark::State& state)
+    {
+        TJsonWrapperImpl jsonWrapper;
+        jsonWrapper.Parse(GenerateNested());
+
+        std::string path;
+        for (int depth = 0; depth < kNestingDepth; ++depth)
+        {
+            path += "/child";
+        }
+        const Wrappers::JsonPath leaf{path + "/leaf"};
+
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(jsonWrapper.GetInt(leaf));
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+     * @brief One request: parse, walk the nested objects, build a reply and drop everything.
+     * @param arena Allocate the request from a `std::pmr::monotonic_buffer_resource` released after each request,
+     *        rather than from the heap.
+     */
+    template<typename TJsonWrapperImpl>
+    void BenchRequest(benchmark::State& state, bool arena)
+    {
+        const std::string json = GenerateNested();
+
+        std::vector<std::byte> buffer(kArenaSize);
+        std::pmr::monotonic_buffer_resource resource{buffer.data(), buffer.size()};
+
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            {
+                std::unique_ptr<Wrappers::IJsonWrapper> request{
+                    arena ? new (&resource) TJsonWrapperImpl{&resource} : new TJsonWrapperImpl{}};
+                request->Parse(json);
+
+                std::unique_ptr<Wrappers::IJsonWrapper> current = request->GetObject("child");
+                for (int depth = 1; depth < kNestingDepth; ++depth)
+                {
+                    current = current->GetObject("child");
+                }
+
+                std::unique_ptr<Wrappers::IJsonWrapper> reply = request->GetEmptyObject();
+                reply->SetInt("leaf", current->GetInt("leaf"));
+                reply->SetString("status", "ok");
+                benchmark::DoNotOptimize(reply->ToString());
+            }
+            resource.release();
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /**
+     * @class CountingResource
+     * @brief Forwards to the default resource and keeps count of the bytes in use.
+     */
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t InUse() const
+        {
+            return _inUse;
+        }
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            void* memory = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            _inUse += bytes;
+            return memory;
+        }
+
+        void do_deallocate(void* memory, std::size_t bytes, std::size_t alignment) override
+        {
+            _inUse -= bytes;
+            std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        std::size_t _inUse{0};
+    };
+
+    /**
+     * @brief Parse the message into a fresh document, reporting the memory the document holds as `bytes`.
+     */
+    template<typename TJsonWrapperImpl>
+    void BenchFootprint(benchmark::State& state)
+    {
+        const std::string& json = LoadCorpus("message.json");
+
+        CountingResource resource;
+        std::size_t footprint = 0;
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            TJsonWrapperImpl jsonWrapper{&resource};
+            jsonWrapper.Parse(json);
+            footprint = resource.InUse();
+            benchmark::DoNotOptimize(jsonWrapper.HasKey("id"));
+        }
+        ReportAllocations(state, startCount);
+
+        state.counters["bytes"] = static_cast<double>(footprint);
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(json.size()));
+    }
+
+    /**
+     * @brief `{"samples":[...]}` with `kSampleCount` doubles, the shape of a telemetry payload.
+     */
+    std::string GenerateSamples()
+    {
+        std::vector<double> samples;
+        for (int i = 0; i < kSampleCount; ++i)
+        {
+            samples.push_back(i * 0.25 - 17.5);
+        }
+
+        Wrappers::NlohmannJsonWrapper jsonWrapper;
+        jsonWrapper.SetDoubleArray("samples", samples.data(), samples.size());
+
+        return jsonWrapper.ToString();
+    }
+
+    template<typename TJsonWrapperImpl>
+    void BenchArrayBulk(benchmark::State& state)
+    {
+        TJsonWrapperImpl jsonWrapper;
+        jsonWrapper.Parse(GenerateSamples());
+
+        std::vector<double> samples;
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            jsonWrapper.GetDoubleArray("samples", samples);
+            benchmark::DoNotOptimize(samples.data());
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations() * kSampleCount);
+    }
+
+    template<typename TJsonWrapperImpl>
+    void BenchArrayElements(benchmark::State& state)
+    {
+        TJsonWrapperImpl jsonWrapper;
+        jsonWrapper.Parse(GenerateSamples());
+
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            const Wrappers::JsonView samples = jsonWrapper.GetArrayView("samples");
+            double sum = 0;
+            for (std::size_t i = 0; i < samples.Size(); ++i)
+            {
+                sum += samples.Element(i).AsDouble();
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetItemsProcessed(state.iterations() * kSampleCount);
+    }
+
+    template<typename TJsonWrapperImpl>
+    void BenchStream(benchmark::State& state)
+    {
+        std::string batch;
+        for (int i = 0; i < kStreamDocumentCount; ++i)
+        {
+            batch += GenerateMessage();
+            batch.push_back('\n');
+        }
+
+        TJsonWrapperImpl jsonWrapper;
+        const uint64_t startCount = allocationCount.load(std::memory_order_relaxed);
+        for (auto _ : state)
+        {
+            Wrappers::JsonStream stream{jsonWrapper, batch};
+            while (stream.Next())
+            {
+                benchmark::DoNotOptimize(jsonWrapper.GetInt("id"));
+            }
+        }
+        ReportAllocations(state, startCount);
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(batch.size()));
+        state.SetItemsProcessed(state.iterations() * kStreamDocumentCount);
+    }
+
+    // #endregion
+
+    template<typename TJsonWrapperImpl>
+    void RegisterBackend()
+    {
+        const std::string backend = BackendName<TJsonWrapperImpl>();
+
+        for (const std::string& corpusName : corpusNames)
+        {
+            benchmark::RegisterBenchmark(("Parse/" + backend + "/" + corpusName).c_str(),
+                                         BenchParse<TJsonWrapperImpl>,
+                                         corpusName);
+            benchmark::RegisterBenchmark(("Feed/" + backend + "/" + corpusName).c_str(),
+                                         BenchFeed<TJsonWrapperImpl>,
+                                         corpusName)
+                ->ArgName("chunk")
+                ->Arg(1460)
+                ->Arg(65536);
+            benchmark::RegisterBenchmark(("ToString/" + backend + "/" + corpusName).c_str(),
+                                         BenchToString<TJsonWrapperImpl>,
+                                         corpusName);
+            benchmark::RegisterBenchmark(("SerializeTo/" + backend + "/" + corpusName).c_str(),
+                                         BenchSerializeTo<TJsonWrapperImpl>,
+                                         corpusName);
+            if ("message.json" != corpusName)
+            {
+                benchmark::RegisterBenchmark(("ParseFile/" + backend + "/" + corpusName).c_str(),
+                                             BenchParseFile<TJsonWrapperImpl>,
+                                             corpusName);
+                benchmark::RegisterBenchmark(("SerializeParallel/" + backend + "/" + corpusName).c_str(),
+                                             BenchSerializeParallel<TJsonWrapperImpl>,
+                                             corpusName)
+                    ->ArgName("threads")
+                    ->Arg(1)
+                    ->Arg(4)
+                    ->UseRealTime();
+            }
+        }
+
+        benchmark::RegisterBenchmark(("ParseBatch/" + backend).c_str(), BenchParseBatch<TJsonWrapperImpl>)
+            ->ArgName("threads")
+            ->Arg(1)
+            ->Arg(4)
+            ->Arg(16)
+            ->UseRealTime();
+        if (TJsonWrapperImpl{}.AllowsConcurrentReads())
+        {
+            benchmark::RegisterBenchmark(("CachedParse/" + backend).c_str(), BenchCachedParse<TJsonWrapperImpl>)
+                ->Threads(1)
+                ->Threads(4);
+        }
+        benchmark::RegisterBenchmark(("Hop/Text/" + backend).c_str(), BenchHop<TJsonWrapperImpl>, false);
+        benchmark::RegisterBenchmark(("Hop/Cbor/" + backend).c_str(), BenchHop<TJsonWrapperImpl>, true);
+        benchmark::RegisterBenchmark(("Route/Eager/" + backend).c_str(), BenchRoute<TJsonWrapperImpl>, false);
+        benchmark::RegisterBenchmark(("Route/Lazy/" + backend).c_str(), BenchRoute<TJsonWrapperImpl>, true);
+        benchmark::RegisterBenchmark(("SetScalars/" + backend).c_str(), BenchSetScalars<TJsonWrapperImpl>);
+        benchmark::RegisterBenchmark(("Respond/Dom/" + backend).c_str(), BenchRespondDom<TJsonWrapperImpl>);
+        benchmark::RegisterBenchmark(("Adopt/Events/" + backend).c_str(), BenchAdopt<TJsonWrapperImpl>, false);
+        benchmark::RegisterBenchmark(("Adopt/RoundTrip/" + backend).c_str(), BenchAdopt<TJsonWrapperImpl>, true);
+        benchmark::RegisterBenchmark(("GetScalars/" + backend).c_str(), BenchGetScalars<TJsonWrapperImpl>);
+        benchmark::RegisterBenchmark(("GetScalars/Keys/" + backend).c_str(), BenchGetScalarsByKey<TJsonWrapperImpl>);
+        benchmark::RegisterBenchmark(("Extract/Virtual/" + backend).c_str(), BenchExtract<TJsonWrapperImpl>, true);
+        benchmark::RegisterBenchmark(("Extract/Static/" + backend).c_str(), BenchExtract<TJsonWrapperImpl>, false);
+        benchmark::RegisterBenchmark(("Bind/Getters/" + backend).c_str(), BenchBind<TJsonWrapperImpl>, false);
+        benchmark::RegisterBenchmark(("Bind/DecodeStruct/" + backend).c_str(), BenchBind<TJsonWrapperImpl>, true);
+        benchmark::RegisterBenchmark(
+            ("OptionalLookups/Throwing/" + backend).c_str(), BenchOptionalLookups<TJsonWrapperImpl>, false);
+        benchmark::RegisterBenchmark(
+            ("OptionalLookups/Try/" + backend).c_str(), BenchOptionalLookups<TJsonWrapperImpl>, true);
+        benchmark::RegisterBenchmark(("NestedObjects/" + backend).c_str(), BenchNestedObjects<TJsonWrapperImpl>);
+        benchmark::RegisterBenchmark(("NestedViews/" + backend).c_str(), BenchNestedViews<TJsonWrapperImpl>);
+        benchmark::RegisterBenchmark(("NestedPath/" + backend).c_str(), BenchNestedPath<TJsonWrapperImpl>);
+        if constexpr (std::is_constructible_v<TJsonWrapperImpl, std::pmr::memory_resource*>)
+        {
+            benchmark::RegisterBenchmark(("Request/Heap/" + backend).c_str(), BenchRequest<TJsonWrapperImpl>, false);
+            benchmark::RegisterBenchmark(("Request/Arena/" + backend).c_str(), BenchRequest<TJsonWrapperImpl>, true);
+            benchmark::RegisterBenchmark(("Footprint/" + backend).c_str(), BenchFootprint<TJsonWrapperImpl>);
+        }
+        benchmark::RegisterBenchmark(("ArrayBulk/" + backend).c_str(), BenchArrayBulk<TJsonWrapperImpl>);
+        benchmark::RegisterBenchmark(("ArrayElements/" + backend).c_str(), BenchArrayElements<TJsonWrapperImpl>);
+        benchmark::RegisterBenchmark(("Stream/" + backend).c_str(), BenchStream<TJsonWrapperImpl>);
+    }
+
+    template<typename... TJsonWrapperImpls>
+    void RegisterAll(BackendList<TJsonWrapperImpls...> /*backends*/)
+    {
+        (RegisterBackend<TJsonWrapperImpls>(), ...);
+        benchmark::RegisterBenchmark("Respond/Writer", BenchRespondWriter);
+    }
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    RegisterAll(BenchmarkTypes{});
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return EXIT_SUCCESS;
+}
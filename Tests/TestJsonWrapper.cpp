@@ -2,16 +2,52 @@
  * @file TestIJsonWrapper.cpp
  * @brief This file contains test cases for `Wrappers::IJsonWrapper` interface.
  ************************************************************************************/
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <fstream>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "Exceptions/XJsonError.hpp"
 #include "Implementations/NlohmannJsonWrapper.hpp"
+#include "Implementations/SimdJsonWrapper.hpp"
+#include "Interfaces/IJsonSink.hpp"
 #include "Interfaces/IJsonWrapper.hpp"
+#include "Interfaces/JsonBackendRegistry.hpp"
+#include "Interfaces/JsonBatch.hpp"
+#include "Interfaces/JsonBinaryFormat.hpp"
+#include "Interfaces/JsonBinding.hpp"
+#include "Interfaces/JsonDocument.hpp"
+#include "Interfaces/JsonDocumentCache.hpp"
+#include "Interfaces/JsonFeedParser.hpp"
+#include "Interfaces/JsonKey.hpp"
+#include "Interfaces/JsonPath.hpp"
+#include "Interfaces/JsonResult.hpp"
+#include "Interfaces/JsonStream.hpp"
+#include "Interfaces/JsonView.hpp"
+#include "Interfaces/JsonWriter.hpp"
+
+// the backends can be forward-declared, e.g. in headers that only pass them around
+namespace Wrappers
+{
+    class NlohmannJsonWrapper;
+    class NlohmannFlatJsonWrapper;
+    class NlohmannPmrJsonWrapper;
+    class SimdJsonWrapper;
+}  // namespace Wrappers
 
 /**
  * @brief Typed test fixture class for `Wrapper::IJsonWrapper` interface implementations.
@@ -35,7 +71,10 @@ public:
 /*
  * @brief Type list of all the implementations of `Wrappers::IJsonWrapper` that are to be tested.
  */
-using TestTypes = ::testing::Types<Wrappers::NlohmannJsonWrapper>;
+using TestTypes = ::testing::Types<Wrappers::NlohmannJsonWrapper,
+                                   Wrappers::NlohmannFlatJsonWrapper,
+                                   Wrappers::NlohmannPmrJsonWrapper,
+                                   Wrappers::SimdJsonWrapper>;
 
 /*
  * @brief Initialize typed test suite for the type list.
@@ -301,3 +340,1611 @@ TYPED_TEST(TestIJsonWrapper, ParseIllFormedJsonNonUtf8)
 
     EXPECT_THROW(jsonWrapper.Parse(invalidJson), Wrappers::XJsonError);
 }
+
+TYPED_TEST(TestIJsonWrapper, OverwriteValue)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+    const std::string key = "Key";
+
+    jsonWrapper.SetInt(key, 1);
+    jsonWrapper.SetString(key, "value");
+
+    const std::string expectedJson = R"({"Key":"value"})";
+
+    EXPECT_EQ(jsonWrapper.ToString(), expectedJson);
+    EXPECT_THROW(jsonWrapper.GetInt(key), Wrappers::XJsonError);
+}
+
+TYPED_TEST(TestIJsonWrapper, ParseReplacesPreviousDocument)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    jsonWrapper.Parse(R"({"first": 1, "shared": "a"})");
+    EXPECT_EQ(jsonWrapper.GetInt("first"), 1);
+    EXPECT_EQ(jsonWrapper.GetString("shared"), "a");
+
+    jsonWrapper.Parse(R"({"second": 2, "shared": "b"})");
+    EXPECT_FALSE(jsonWrapper.HasKey("first"));
+    EXPECT_EQ(jsonWrapper.GetInt("second"), 2);
+    EXPECT_EQ(jsonWrapper.GetString("shared"), "b");
+}
+
+TYPED_TEST(TestIJsonWrapper, StringViewKeysAndValues)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    jsonWrapper.Parse(R"({"plain": "value", "escaped": "a\"b\u00e9", "number": 1})");
+
+    // keys sliced out of a larger buffer, not NUL terminated
+    const std::string_view keys = "plainescapednumber";
+    const std::string_view plainKey = keys.substr(0, 5);
+    const std::string_view escapedKey = keys.substr(5, 7);
+    const std::string_view numberKey = keys.substr(12);
+
+    const std::string_view plain = jsonWrapper.GetStringView(plainKey);
+    const std::string_view escaped = jsonWrapper.GetStringView(escapedKey);
+
+    EXPECT_EQ(plain, "value");
+    EXPECT_EQ(escaped, "a\"b\xC3\xA9");
+    EXPECT_EQ(jsonWrapper.GetInt(numberKey), 1);
+    EXPECT_TRUE(jsonWrapper.HasKey(plainKey));
+    EXPECT_FALSE(jsonWrapper.HasKey(keys));
+
+    // views stay valid across further reads
+    EXPECT_EQ(jsonWrapper.GetString(escapedKey), escaped);
+    EXPECT_EQ(plain, "value");
+
+    EXPECT_THROW(jsonWrapper.GetStringView(numberKey), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.GetStringView("absent"), Wrappers::XJsonError);
+}
+
+TYPED_TEST(TestIJsonWrapper, ObjectView)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    jsonWrapper.Parse(R"({"a": {"b": {"c": 7, "name": "x\ty", "flag": true, "nothing": null}, "d": 2.5}, "e": 1})");
+
+    const Wrappers::JsonView outer = jsonWrapper.GetObjectView("a");
+    const Wrappers::JsonView inner = outer.GetObjectView("b");
+
+    EXPECT_EQ(inner.GetInt("c"), 7);
+    EXPECT_EQ(inner.GetUnsigned("c"), 7U);
+    EXPECT_EQ(inner.GetStringView("name"), "x\ty");
+    EXPECT_TRUE(inner.GetBool("flag"));
+    EXPECT_TRUE(inner.IsNull("nothing"));
+    EXPECT_DOUBLE_EQ(outer.GetDouble("d"), 2.5);
+    EXPECT_TRUE(outer.HasKey("b"));
+    EXPECT_FALSE(inner.HasKey("e"));
+    EXPECT_EQ(jsonWrapper.View().GetInt("e"), 1);
+
+    EXPECT_EQ(inner.ToString(), R"({"c":7,"flag":true,"name":"x\ty","nothing":null})");
+    EXPECT_EQ(inner.ToObject()->GetInt("c"), 7);
+
+    EXPECT_THROW(outer.GetObjectView("d"), Wrappers::XJsonError);
+    EXPECT_THROW(inner.GetInt("absent"), Wrappers::XJsonError);
+    EXPECT_THROW(inner.IsNull("absent"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.GetObjectView("e"), Wrappers::XJsonError);
+}
+
+TYPED_TEST(TestIJsonWrapper, NestedSetObject)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    std::unique_ptr<Wrappers::IJsonWrapper> current = jsonWrapper.GetEmptyObject();
+    current->SetInt("leaf", 3);
+    for (int depth = 0; depth < 3; ++depth)
+    {
+        std::unique_ptr<Wrappers::IJsonWrapper> parent = jsonWrapper.GetEmptyObject();
+        parent->SetObject("child", std::move(current));
+        parent->SetInt("depth", depth);
+        current = std::move(parent);
+    }
+    jsonWrapper.SetObject("root", std::move(current));
+
+    const std::string expectedJson =
+        R"({"root":{"child":{"child":{"child":{"leaf":3},"depth":0},"depth":1},"depth":2}})";
+
+    EXPECT_EQ(jsonWrapper.ToString(), expectedJson);
+    EXPECT_EQ(jsonWrapper.GetObjectView("root").GetObjectView("child").GetInt("depth"), 1);
+}
+
+TYPED_TEST(TestIJsonWrapper, PathAccess)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    jsonWrapper.Parse(R"({"a": {"b": {"c": 7}, "s": "x"}, "k/ey": {"t~": true}})");
+
+    const Wrappers::JsonPath pointer{"/a/b/c"};
+
+    EXPECT_EQ(jsonWrapper.GetInt(pointer), 7);
+    EXPECT_EQ(jsonWrapper.GetInt(Wrappers::JsonPath{"a.b.c"}), 7);
+    EXPECT_TRUE(jsonWrapper.GetBool(Wrappers::JsonPath{"/k~1ey/t~0"}));
+    EXPECT_EQ(jsonWrapper.GetStringView(Wrappers::JsonPath{"a.s"}), "x");
+    EXPECT_EQ(jsonWrapper.GetObjectView(Wrappers::JsonPath{"/a/b"}).GetInt("c"), 7);
+    EXPECT_TRUE(jsonWrapper.HasKey(pointer));
+    EXPECT_FALSE(jsonWrapper.HasKey(Wrappers::JsonPath{"/a/x/c"}));
+    EXPECT_THROW(jsonWrapper.GetInt(Wrappers::JsonPath{"/a/s/c"}), Wrappers::XJsonError);
+
+    jsonWrapper.SetInt(pointer, 8);
+    jsonWrapper.SetString(Wrappers::JsonPath{"a.new.deep"}, "v");
+    jsonWrapper.SetNull(Wrappers::JsonPath{"/n"});
+
+    const std::string expectedJson =
+        R"({"a":{"b":{"c":8},"new":{"deep":"v"},"s":"x"},"k/ey":{"t~":true},"n":null})";
+
+    EXPECT_EQ(jsonWrapper.ToString(), expectedJson);
+    EXPECT_EQ(jsonWrapper.GetInt(pointer), 8);
+
+    // a failed set leaves the document untouched
+    EXPECT_THROW(jsonWrapper.SetInt(Wrappers::JsonPath{"a.s.c"}, 1), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.SetInt(Wrappers::JsonPath{""}, 1), Wrappers::XJsonError);
+    EXPECT_EQ(jsonWrapper.ToString(), expectedJson);
+
+    this->_innerObject->SetBool(Wrappers::JsonPath{"x.y"}, true);
+    EXPECT_EQ(this->_innerObject->ToString(), R"({"x":{"y":true}})");
+
+    EXPECT_THROW(Wrappers::JsonPath{"/a~2"}, Wrappers::XJsonError);
+    EXPECT_THROW(Wrappers::JsonPath{"a..b"}, Wrappers::XJsonError);
+}
+
+TYPED_TEST(TestIJsonWrapper, Arrays)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    const std::vector<int64_t> integers{-1, 0, 42};
+    const std::vector<uint64_t> unsignedIntegers{0, std::numeric_limits<uint64_t>::max()};
+    const std::vector<double> doubles{0.5, -2.25, 100.0};
+    const std::vector<std::string_view> strings{"a", "b\"c"};
+
+    jsonWrapper.SetIntArray("integers", integers.data(), integers.size());
+    jsonWrapper.SetUnsignedArray("unsigned", unsignedIntegers.data(), unsignedIntegers.size());
+    jsonWrapper.SetDoubleArray("doubles", doubles.data(), doubles.size());
+    jsonWrapper.SetStringArray("strings", strings.data(), strings.size());
+    jsonWrapper.SetDoubleArray("empty", nullptr, 0);
+
+    const std::string expectedJson =
+        R"({"doubles":[0.5,-2.25,100.0],"empty":[],"integers":[-1,0,42],"strings":["a","b\"c"],)"
+        R"("unsigned":[0,18446744073709551615]})";
+
+    EXPECT_EQ(jsonWrapper.ToString(), expectedJson);
+
+    std::vector<int64_t> integerValues;
+    std::vector<uint64_t> unsignedValues;
+    std::vector<double> doubleValues{1.0, 2.0, 3.0, 4.0};
+    jsonWrapper.GetIntArray("integers", integerValues);
+    jsonWrapper.GetUnsignedArray("unsigned", unsignedValues);
+    jsonWrapper.GetDoubleArray("doubles", doubleValues);
+
+    EXPECT_EQ(integerValues, integers);
+    EXPECT_EQ(unsignedValues, unsignedIntegers);
+    EXPECT_EQ(doubleValues, doubles);
+    EXPECT_EQ(jsonWrapper.GetArraySize("empty"), 0U);
+    EXPECT_EQ(jsonWrapper.GetArrayView("strings").Element(1).AsStringView(), "b\"c");
+
+    double buffer[3]{};
+    EXPECT_EQ(jsonWrapper.GetDoubleArray("doubles", buffer, 3), 3U);
+    EXPECT_DOUBLE_EQ(buffer[1], -2.25);
+    EXPECT_THROW(jsonWrapper.GetDoubleArray("doubles", buffer, 2), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.GetIntArray("strings", integerValues), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.GetDoubleArray("absent", doubleValues), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.GetArrayView("integers").Element(3), Wrappers::XJsonError);
+
+    jsonWrapper.Parse(R"({"points": [{"x": 1}, {"x": 2}], "matrix": [[1, 2], [3, 4.5]], "flags": [true, null]})");
+
+    const Wrappers::JsonView points = jsonWrapper.GetArrayView("points");
+    ASSERT_EQ(points.Size(), 2U);
+    EXPECT_TRUE(points.IsArray());
+    EXPECT_TRUE(points.Element(0).IsObject());
+    EXPECT_EQ(points.Element(1).GetInt("x"), 2);
+
+    const Wrappers::JsonView matrix = jsonWrapper.GetArrayView("matrix");
+    matrix.Element(0).AsIntArray(integerValues);
+    EXPECT_EQ(integerValues, (std::vector<int64_t>{1, 2}));
+    EXPECT_DOUBLE_EQ(matrix.Element(1).Element(1).AsDouble(), 4.5);
+    EXPECT_EQ(matrix.ToString(), "[[1,2],[3,4.5]]");
+
+    const Wrappers::JsonView flags = jsonWrapper.GetArrayView("flags");
+    EXPECT_TRUE(flags.Element(0).AsBool());
+    EXPECT_TRUE(flags.Element(1).IsNull());
+
+    EXPECT_EQ(jsonWrapper.GetInt(Wrappers::JsonPath{"/matrix/1/0"}), 3);
+    EXPECT_EQ(jsonWrapper.GetInt(Wrappers::JsonPath{"points.1.x"}), 2);
+    EXPECT_EQ(jsonWrapper.GetArrayView(Wrappers::JsonPath{"/matrix/0"}).Size(), 2U);
+    EXPECT_FALSE(jsonWrapper.HasKey(Wrappers::JsonPath{"/matrix/2"}));
+    EXPECT_FALSE(jsonWrapper.HasKey(Wrappers::JsonPath{"/matrix/01"}));
+    EXPECT_FALSE(jsonWrapper.HasKey(Wrappers::JsonPath{"/points/x"}));
+    EXPECT_THROW(jsonWrapper.GetArrayView("absent"), Wrappers::XJsonError);
+    EXPECT_THROW(points.Element(0).AsInt(), Wrappers::XJsonError);
+}
+
+TYPED_TEST(TestIJsonWrapper, DocumentStream)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    const std::string batch = "{\"id\": 1}\n\n{\"id\": 2, \"tags\": [\"a\"]}\r\n   \n{\"id\": 3}";
+
+    std::vector<int64_t> ids;
+    Wrappers::JsonStream stream{jsonWrapper, batch};
+    while (stream.Next())
+    {
+        ids.push_back(jsonWrapper.GetInt("id"));
+    }
+
+    EXPECT_EQ(ids, (std::vector<int64_t>{1, 2, 3}));
+    EXPECT_FALSE(stream.Next());
+
+    std::istringstream input{"{\"id\": 4}\n{\"id\": 5}\n"};
+    Wrappers::JsonStream inputStream{jsonWrapper, input};
+
+    ASSERT_TRUE(inputStream.Next());
+    EXPECT_EQ(jsonWrapper.GetInt("id"), 4);
+    EXPECT_EQ(inputStream.Offset(), 0U);
+    ASSERT_TRUE(inputStream.Next());
+    EXPECT_EQ(jsonWrapper.GetInt("id"), 5);
+    EXPECT_EQ(inputStream.Offset(), 10U);
+    EXPECT_FALSE(inputStream.Next());
+
+    Wrappers::JsonStream malformed{jsonWrapper, std::string_view{"{\"id\": 1}\n{\"id\": }\n"}};
+    EXPECT_TRUE(malformed.Next());
+    EXPECT_THROW(malformed.Next(), Wrappers::XJsonError);
+
+    Wrappers::JsonStream truncated{jsonWrapper, std::string_view{"{\"id\": 1}\n{\"id\": 2"}};
+    EXPECT_TRUE(truncated.Next());
+    EXPECT_THROW(truncated.Next(), Wrappers::XJsonError);
+
+    // the current document can be read again and edited, and outlives the stream and its batch
+    {
+        const std::string scopedBatch = "{\"id\": 6, \"name\": \"six\"}\n{\"id\": 7, \"tags\": [\"x\", \"y\"]}";
+        Wrappers::JsonStream scoped{jsonWrapper, scopedBatch};
+        ASSERT_TRUE(scoped.Next());
+        EXPECT_EQ(jsonWrapper.GetStringView("name"), "six");
+        EXPECT_EQ(jsonWrapper.GetInt("id"), 6);
+        jsonWrapper.SetInt("id", 60);
+        EXPECT_EQ(jsonWrapper.GetInt("id"), 60);
+        ASSERT_TRUE(scoped.Next());
+        EXPECT_EQ(jsonWrapper.GetArrayView("tags").Element(1).AsStringView(), "y");
+        EXPECT_EQ(jsonWrapper.GetInt("id"), 7);
+    }
+    EXPECT_EQ(jsonWrapper.ToString(), "{\"id\":7,\"tags\":[\"x\",\"y\"]}");
+    EXPECT_EQ(jsonWrapper.GetInt("id"), 7);
+}
+
+TYPED_TEST(TestIJsonWrapper, ParseFile)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    // one file per backend, since ctest runs the typed tests in parallel and a file mapped by one must not be
+    // truncated by another
+    const std::string filePath = ::testing::TempDir() + "TestIJsonWrapperParseFile." +
+                                 ::testing::UnitTest::GetInstance()->current_test_info()->type_param() + ".json";
+    const auto writeFile = [&filePath](const std::string& content) {
+        std::ofstream file{filePath, std::ios::binary | std::ios::trunc};
+        file << content;
+    };
+
+    // exactly one page, so that the padding has to come from past the end of the file
+    std::string json = "{\"name\": \"file\", \"values\": [1, 2, 3], \"pad\": \"\"}";
+    const std::size_t padSize = 4096 - json.size();
+    json.insert(json.size() - 2, padSize, 'x');
+    ASSERT_EQ(json.size(), 4096U);
+    writeFile(json);
+
+    jsonWrapper.ParseFile(filePath);
+    EXPECT_EQ(jsonWrapper.GetStringView("name"), "file");
+    EXPECT_EQ(jsonWrapper.GetArraySize("values"), 3U);
+    EXPECT_EQ(jsonWrapper.GetString("pad").size(), padSize);
+
+    jsonWrapper.SetInt("id", 7);
+    EXPECT_EQ(jsonWrapper.GetInt("id"), 7);
+    EXPECT_EQ(jsonWrapper.GetString("name"), "file");
+
+    writeFile("{\"id\": }");
+    EXPECT_THROW(jsonWrapper.ParseFile(filePath), Wrappers::XJsonError);
+
+    writeFile("");
+    EXPECT_THROW(jsonWrapper.ParseFile(filePath), Wrappers::XJsonError);
+
+    EXPECT_THROW(jsonWrapper.ParseFile(filePath + ".missing"), Wrappers::XJsonError);
+
+    // not NUL terminated: only the first `length` bytes are parsed
+    const std::string slice = "{\"id\": 8}{\"id\": 9}";
+    jsonWrapper.Parse(slice.data(), 9);
+    EXPECT_EQ(jsonWrapper.GetInt("id"), 8);
+}
+
+TYPED_TEST(TestIJsonWrapper, SerializeTo)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    jsonWrapper.Parse("{\"b\": [1, -2, 3.5, \"x\\ny\"], \"a\": {\"c\": null, \"d\": true}, \"e\": \"\xc3\xa9\"}");
+    const std::string expected = jsonWrapper.ToString();
+
+    std::string reused = "previous content";
+    jsonWrapper.SerializeTo(reused);
+    EXPECT_EQ(reused, expected);
+
+    std::vector<char> buffer(expected.size());
+    EXPECT_EQ(jsonWrapper.SerializeTo(buffer.data(), buffer.size()), expected.size());
+    EXPECT_EQ(std::string(buffer.begin(), buffer.end()), expected);
+
+    // too small: the length is still reported and the prefix that fits is written
+    std::vector<char> shortBuffer(8);
+    EXPECT_EQ(jsonWrapper.SerializeTo(shortBuffer.data(), shortBuffer.size()), expected.size());
+    EXPECT_EQ(std::string(shortBuffer.begin(), shortBuffer.end()), expected.substr(0, shortBuffer.size()));
+
+    class StringSink : public Wrappers::IJsonSink
+    {
+    public:
+        void Write(std::string_view chunk) override
+        {
+            text.append(chunk);
+            ++chunks;
+        }
+
+        std::string text;
+        int chunks{0};
+    };
+
+    // large enough to be handed over in several chunks
+    jsonWrapper.SetString("long", std::string(10000, 'z'));
+    StringSink sink;
+    const std::size_t length = jsonWrapper.SerializeTo(sink);
+    EXPECT_EQ(length, sink.text.size());
+    EXPECT_EQ(sink.text, jsonWrapper.ToString());
+    EXPECT_GT(sink.chunks, 1);
+}
+
+TYPED_TEST(TestIJsonWrapper, TryGetters)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    jsonWrapper.Parse(
+        "{\"int\": -7, \"unsigned\": 18446744073709551615, \"double\": 2.5, \"bool\": true, \"string\": \"a\\\"b\", "
+        "\"nested\": {\"name\": \"inner\"}}");
+
+    EXPECT_EQ(*jsonWrapper.TryGetInt("int"), -7);
+    EXPECT_EQ(*jsonWrapper.TryGetUnsigned("unsigned"), std::numeric_limits<uint64_t>::max());
+    EXPECT_DOUBLE_EQ(*jsonWrapper.TryGetDouble("double"), 2.5);
+    EXPECT_TRUE(*jsonWrapper.TryGetBool("bool"));
+    EXPECT_EQ(*jsonWrapper.TryGetString("string"), "a\"b");
+    EXPECT_EQ(*jsonWrapper.TryGetStringView("string"), "a\"b");
+    EXPECT_EQ(jsonWrapper.TryGetStringView(Wrappers::JsonPath{"/nested/name"}).Value(), "inner");
+
+    const Wrappers::JsonResult<int64_t> missing = jsonWrapper.TryGetInt("missing");
+    EXPECT_FALSE(missing);
+    EXPECT_EQ(missing.Error(), Wrappers::JsonErrorCode::NoSuchKey);
+    EXPECT_EQ(missing.ValueOr(3), 3);
+    EXPECT_THROW(missing.Value(), Wrappers::XJsonError);
+
+    EXPECT_EQ(jsonWrapper.TryGetBool("string").Error(), Wrappers::JsonErrorCode::IncorrectType);
+    EXPECT_EQ(jsonWrapper.TryGetString("int").Error(), Wrappers::JsonErrorCode::IncorrectType);
+    EXPECT_EQ(jsonWrapper.TryGetInt("nested").Error(), Wrappers::JsonErrorCode::IncorrectType);
+    EXPECT_EQ(jsonWrapper.TryGetInt(Wrappers::JsonPath{"/nested/missing"}).Error(),
+              Wrappers::JsonErrorCode::NoSuchKey);
+
+    // a miss leaves the document readable
+    EXPECT_EQ(jsonWrapper.GetInt("int"), -7);
+}
+
+TYPED_TEST(TestIJsonWrapper, MemoryResource)
+{
+    if constexpr (!std::is_constructible_v<TypeParam, std::pmr::memory_resource*>)
+    {
+        GTEST_SKIP() << "The backend takes its native arena instead.";
+    }
+    else
+    {
+        class CountingResource : public std::pmr::memory_resource
+        {
+        public:
+            std::size_t allocations{0};
+            std::size_t outstanding{0};
+
+        private:
+            void* do_allocate(std::size_t size, std::size_t alignment) override
+            {
+                ++allocations;
+                outstanding += size;
+                return std::pmr::new_delete_resource()->allocate(size, alignment);
+            }
+
+            void do_deallocate(void* memory, std::size_t size, std::size_t alignment) override
+            {
+                outstanding -= size;
+                std::pmr::new_delete_resource()->deallocate(memory, size, alignment);
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+            {
+                return this == &other;
+            }
+        };
+
+        const std::string longValue(64, 'v');
+
+        CountingResource resource;
+        {
+            std::unique_ptr<Wrappers::IJsonWrapper> jsonWrapper{new (&resource) TypeParam{&resource}};
+            jsonWrapper->Parse("{\"name\": \"" + longValue + "\", \"inner\": {\"id\": 7}}");
+
+            const std::size_t allocations = resource.allocations;
+            std::unique_ptr<Wrappers::IJsonWrapper> inner = jsonWrapper->GetObject("inner");
+            EXPECT_GT(resource.allocations, allocations);
+            EXPECT_EQ(inner->GetInt("id"), 7);
+
+            std::unique_ptr<Wrappers::IJsonWrapper> emptyObject = jsonWrapper->GetEmptyObject();
+            emptyObject->SetString("key", longValue);
+            jsonWrapper->SetObject("added", std::move(emptyObject));
+            EXPECT_EQ(jsonWrapper->GetObject("added")->GetString("key"), longValue);
+            EXPECT_EQ(jsonWrapper->GetString("name"), longValue);
+        }
+
+        // everything went back to the resource it came from
+        EXPECT_GT(resource.allocations, 0U);
+        EXPECT_EQ(resource.outstanding, 0U);
+
+        // subclasses aligned beyond the tag keep their alignment, and are released to their resource
+        if constexpr (!std::is_final_v<TypeParam>)
+        {
+            struct alignas(64) Aligned : TypeParam
+            {
+                using TypeParam::TypeParam;
+            };
+
+            Aligned* const fromResource = new (&resource) Aligned{&resource};
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(fromResource) % alignof(Aligned), 0U);
+            std::unique_ptr<Wrappers::IJsonWrapper> jsonWrapper{fromResource};
+            jsonWrapper->Parse("{\"inner\": {\"id\": 8}}");
+            EXPECT_EQ(jsonWrapper->GetObject("inner")->GetInt("id"), 8);
+            jsonWrapper.reset();
+            EXPECT_EQ(resource.outstanding, 0U);
+
+            const std::unique_ptr<Aligned> fromDefault = std::make_unique<Aligned>();
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(fromDefault.get()) % alignof(Aligned), 0U);
+        }
+
+        if constexpr (std::is_same_v<TypeParam, Wrappers::NlohmannPmrJsonWrapper>)
+        {
+            // nodes and strings as well, none from the default resource
+            std::pmr::memory_resource* const previous =
+                std::pmr::set_default_resource(std::pmr::null_memory_resource());
+            {
+                TypeParam jsonWrapper{&resource};
+                jsonWrapper.Parse("{\"name\": \"" + longValue + "\", \"list\": [1, 2, 3]}");
+                jsonWrapper.SetString("added", longValue);
+                EXPECT_EQ(jsonWrapper.GetStringView("added"), longValue);
+            }
+            std::pmr::set_default_resource(previous);
+            EXPECT_EQ(resource.outstanding, 0U);
+        }
+    }
+}
+
+TYPED_TEST(TestIJsonWrapper, JsonDocument)
+{
+    Wrappers::JsonDocument<TypeParam> document;
+    document.Parse("{\"id\": 42, \"name\": \"doc\", \"inner\": {\"flag\": true}}");
+
+    EXPECT_EQ(document.GetInt("id"), 42);
+    EXPECT_EQ(document.GetStringView("name"), "doc");
+    EXPECT_TRUE(document.GetObject("inner").GetBool("flag"));
+    EXPECT_EQ(document.TryGetInt("missing").Error(), Wrappers::JsonErrorCode::NoSuchKey);
+    EXPECT_THROW(document.GetInt("name"), Wrappers::XJsonError);
+
+    Wrappers::JsonDocument<TypeParam> child = document.GetEmptyObject();
+    child.SetInt("depth", 1);
+    document.SetObject("child", std::move(child));
+    EXPECT_EQ(document.GetInt(Wrappers::JsonPath{"/child/depth"}), 1);
+
+    // the same document through the interface
+    Wrappers::IJsonWrapper& jsonWrapper = document.Wrapper();
+    EXPECT_EQ(jsonWrapper.ToString(), document.ToString());
+    jsonWrapper.SetString("name", "renamed");
+    EXPECT_EQ(document.GetString("name"), "renamed");
+
+    Wrappers::JsonDocument<TypeParam> parent;
+    parent.Wrapper().SetObject("document", document.ReleaseWrapper());
+    EXPECT_EQ(parent.GetInt(Wrappers::JsonPath{"/document/child/depth"}), 1);
+
+    child = parent.GetEmptyObject();
+    child.SetInt("depth", 2);
+    parent.SetObject(Wrappers::JsonKey{"keyed"}, std::move(child));
+    child = parent.GetEmptyObject();
+    child.SetInt("depth", 3);
+    parent.SetObject(Wrappers::JsonPath{"/pathed"}, std::move(child));
+    child = parent.GetEmptyObject();
+    child.SetInt("depth", 4);
+    parent.SetObject(Wrappers::JsonPath{"/nested/pathed"}, std::move(child));
+    EXPECT_EQ(parent.GetInt(Wrappers::JsonPath{"/keyed/depth"}), 2);
+    EXPECT_EQ(parent.GetInt(Wrappers::JsonPath{"/pathed/depth"}), 3);
+    EXPECT_EQ(parent.GetInt(Wrappers::JsonPath{"/nested/pathed/depth"}), 4);
+
+    // nested objects have the type of the backend, so that documents adopt them
+    const std::unique_ptr<Wrappers::IJsonWrapper> nested = this->_jsonWrapper.GetEmptyObject();
+    const Wrappers::IJsonWrapper& nestedWrapper = *nested;
+    EXPECT_EQ(typeid(nestedWrapper), typeid(TypeParam));
+    this->_jsonWrapper.SetObject("typed", std::make_unique<TypeParam>());
+    EXPECT_TRUE(this->_jsonWrapper.HasKey("typed"));
+
+    // a subclass could override what the statically dispatched calls skip
+    if constexpr (!std::is_final_v<TypeParam>)
+    {
+        struct Subclass : TypeParam
+        {
+        };
+        EXPECT_THROW(Wrappers::JsonDocument<TypeParam>{std::make_unique<Subclass>()}, Wrappers::XJsonError);
+    }
+}
+
+struct TestAddress
+{
+    std::string city;
+    std::optional<int32_t> zip;
+};
+
+template<>
+struct Wrappers::JsonBinding<TestAddress>
+{
+    static constexpr auto fields =
+        std::make_tuple(Wrappers::Field("city", &TestAddress::city), Wrappers::Field("zip", &TestAddress::zip));
+};
+
+struct TestOrder
+{
+    int64_t id{0};
+    uint16_t quantity{0};
+    double price{0.0};
+    bool paid{false};
+    std::string sku;
+    std::vector<int64_t> lines;
+    std::vector<std::string> tags;
+    TestAddress address;
+    std::optional<TestAddress> billing;
+};
+
+template<>
+struct Wrappers::JsonBinding<TestOrder>
+{
+    static constexpr auto fields = std::make_tuple(Wrappers::Field("id", &TestOrder::id),
+                                                   Wrappers::Field("quantity", &TestOrder::quantity),
+                                                   Wrappers::Field("price", &TestOrder::price),
+                                                   Wrappers::Field("paid", &TestOrder::paid),
+                                                   Wrappers::Field("sku", &TestOrder::sku),
+                                                   Wrappers::Field("lines", &TestOrder::lines),
+                                                   Wrappers::Field("tags", &TestOrder::tags),
+                                                   Wrappers::Field("address", &TestOrder::address),
+                                                   Wrappers::Field("billing", &TestOrder::billing));
+};
+
+struct TestRoute
+{
+    std::vector<TestAddress> stops;
+};
+
+template<>
+struct Wrappers::JsonBinding<TestRoute>
+{
+    static constexpr auto fields = std::make_tuple(Wrappers::Field("stops", &TestRoute::stops));
+};
+
+struct TestSchedule
+{
+    std::vector<TestRoute> routes;
+};
+
+template<>
+struct Wrappers::JsonBinding<TestSchedule>
+{
+    static constexpr auto fields = std::make_tuple(Wrappers::Field("routes", &TestSchedule::routes));
+};
+
+TYPED_TEST(TestIJsonWrapper, StructBinding)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    // out of declaration order, with a key that has no field
+    jsonWrapper.Parse(
+        "{\"sku\": \"A-1\", \"id\": 7, \"unknown\": [1, {}], \"quantity\": 3, \"price\": 9.5, \"paid\": true, "
+        "\"lines\": [1, 2, 3], \"tags\": [\"x\", \"y\"], \"address\": {\"city\": \"Oslo\", \"zip\": 150}, "
+        "\"billing\": null}");
+
+    TestOrder order;
+    order.billing = TestAddress{};
+    Wrappers::DecodeStruct(jsonWrapper, order);
+
+    EXPECT_EQ(order.id, 7);
+    EXPECT_EQ(order.quantity, 3);
+    EXPECT_DOUBLE_EQ(order.price, 9.5);
+    EXPECT_TRUE(order.paid);
+    EXPECT_EQ(order.sku, "A-1");
+    EXPECT_EQ(order.lines, (std::vector<int64_t>{1, 2, 3}));
+    EXPECT_EQ(order.tags, (std::vector<std::string>{"x", "y"}));
+    EXPECT_EQ(order.address.city, "Oslo");
+    EXPECT_EQ(order.address.zip, 150);
+    EXPECT_FALSE(order.billing.has_value());
+
+    // the same mapping writes the struct back through the backend
+    order.billing = TestAddress{"Bergen", std::nullopt};
+    std::unique_ptr<Wrappers::IJsonWrapper> encoded = jsonWrapper.GetEmptyObject();
+    Wrappers::EncodeStruct(order, *encoded);
+    EXPECT_TRUE(encoded->IsNull(Wrappers::JsonPath{"/billing/zip"}));
+
+    TestOrder decoded;
+    Wrappers::DecodeStruct(*encoded, decoded);
+    EXPECT_EQ(decoded.id, order.id);
+    EXPECT_EQ(decoded.sku, order.sku);
+    EXPECT_EQ(decoded.tags, order.tags);
+    EXPECT_EQ(decoded.address.zip, order.address.zip);
+    ASSERT_TRUE(decoded.billing.has_value());
+    EXPECT_EQ(decoded.billing->city, "Bergen");
+
+    jsonWrapper.Parse("{\"stops\": [{\"city\": \"A\"}, {\"city\": \"B\", \"zip\": 2}]}");
+    TestRoute route;
+    Wrappers::DecodeStruct(jsonWrapper, route);
+    ASSERT_EQ(route.stops.size(), 2U);
+    EXPECT_EQ(route.stops[1].city, "B");
+    EXPECT_EQ(route.stops[1].zip, 2);
+
+    // elements holding arrays of their own, read between the elements of the outer array
+    jsonWrapper.Parse("{\"routes\": [{\"stops\": [{\"city\": \"A\"}, {\"city\": \"B\"}]}, {\"stops\": []}, "
+                      "{\"stops\": [{\"city\": \"C\", \"zip\": 3}]}]}");
+    TestSchedule schedule;
+    Wrappers::DecodeStruct(jsonWrapper, schedule);
+    ASSERT_EQ(schedule.routes.size(), 3U);
+    ASSERT_EQ(schedule.routes[0].stops.size(), 2U);
+    EXPECT_EQ(schedule.routes[0].stops[1].city, "B");
+    EXPECT_TRUE(schedule.routes[1].stops.empty());
+    ASSERT_EQ(schedule.routes[2].stops.size(), 1U);
+    EXPECT_EQ(schedule.routes[2].stops[0].zip, 3);
+    const std::vector<Wrappers::JsonView> routes = jsonWrapper.GetArrayView("routes").Elements();
+    ASSERT_EQ(routes.size(), 3U);
+    EXPECT_EQ(routes[2].GetArrayView("stops").Element(0).GetString("city"), "C");
+    EXPECT_THROW(jsonWrapper.GetArrayView("routes").Element(0).Elements(), Wrappers::XJsonError);
+
+    jsonWrapper.Parse("{\"quantity\": 70000}");
+    EXPECT_THROW(Wrappers::DecodeStruct(jsonWrapper, order), Wrappers::XJsonError);
+
+    jsonWrapper.Parse("{\"id\": \"seven\"}");
+    EXPECT_THROW(Wrappers::DecodeStruct(jsonWrapper, order), Wrappers::XJsonError);
+
+    jsonWrapper.Parse("[1, 2]");
+    EXPECT_THROW(Wrappers::DecodeStruct(jsonWrapper, order), Wrappers::XJsonError);
+}
+
+TYPED_TEST(TestIJsonWrapper, ParseLazy)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    jsonWrapper.ParseLazy(R"( {"route": "orders", "payload": {"items": [{"id": 1}, {"id": "}]"}]},)"
+                          R"( "count": 4, "flag": true} )");
+
+    EXPECT_EQ(jsonWrapper.GetStringView("route"), "orders");
+    EXPECT_EQ(jsonWrapper.GetInt("count"), 4);
+    EXPECT_TRUE(jsonWrapper.HasKey("flag"));
+    EXPECT_FALSE(jsonWrapper.HasKey("missing"));
+    EXPECT_EQ(jsonWrapper.TryGetInt("missing").Error(), Wrappers::JsonErrorCode::NoSuchKey);
+    EXPECT_EQ(jsonWrapper.GetString(Wrappers::JsonPath{"/payload/items/1/id"}), "}]");
+
+    jsonWrapper.SetBool("flag", false);
+    EXPECT_EQ(jsonWrapper.ToString(),
+              R"({"count":4,"flag":false,"payload":{"items":[{"id":1},{"id":"}]"}]},"route":"orders"})");
+
+    // not an object: parsed eagerly
+    jsonWrapper.ParseLazy("[1, 2]");
+    EXPECT_EQ(jsonWrapper.ToString(), "[1,2]");
+
+    EXPECT_THROW(jsonWrapper.ParseLazy(R"({"a": [1, 2})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.ParseLazy(R"({"a": "open)"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.ParseLazy(R"({"a": 1 "b": 2})"), Wrappers::XJsonError);
+
+    // a malformed value is reported when it is read at the latest
+    bool parsed = true;
+    try
+    {
+        jsonWrapper.ParseLazy(R"({"good": 1, "bad": tru})");
+    }
+    catch (const Wrappers::XJsonError&)
+    {
+        parsed = false;
+    }
+    if (parsed)
+    {
+        EXPECT_THROW(jsonWrapper.GetBool("bad"), Wrappers::XJsonError);
+        EXPECT_EQ(jsonWrapper.GetInt("good"), 1);
+    }
+
+    // an atom that only starts like null is not null
+    parsed = true;
+    try
+    {
+        jsonWrapper.ParseLazy(R"({"b": nullx})");
+    }
+    catch (const Wrappers::XJsonError&)
+    {
+        parsed = false;
+    }
+    if (parsed)
+    {
+        bool isNull = false;
+        try
+        {
+            isNull = jsonWrapper.IsNull("b");
+        }
+        catch (const Wrappers::XJsonError&)
+        {
+        }
+        EXPECT_FALSE(isNull);
+    }
+}
+
+TYPED_TEST(TestIJsonWrapper, CopyAndMove)
+{
+    if constexpr (!std::is_copy_constructible_v<TypeParam>)
+    {
+        GTEST_SKIP() << "The backend is not copyable.";
+    }
+    else
+    {
+        TypeParam& jsonWrapper = this->_jsonWrapper;
+        jsonWrapper.Parse(R"({"a": 1, "b": {"c": "d"}})");
+
+        TypeParam copy = jsonWrapper;
+        copy.SetInt("a", 2);
+        EXPECT_EQ(jsonWrapper.GetInt("a"), 1);
+        EXPECT_EQ(copy.GetInt("a"), 2);
+        EXPECT_EQ(copy.GetObject("b")->GetString("c"), "d");
+
+        // a lazy document is decoded in full by the copy
+        const std::string text = R"({"route": "orders", "count": 4})";
+        jsonWrapper.ParseLazy(text);
+        EXPECT_EQ(jsonWrapper.GetInt("count"), 4);
+        copy = jsonWrapper;
+        EXPECT_EQ(copy.ToString(), R"({"count":4,"route":"orders"})");
+        EXPECT_EQ(jsonWrapper.GetStringView("route"), "orders");
+
+        TypeParam moved = std::move(jsonWrapper);
+        EXPECT_EQ(moved.GetInt("count"), 4);
+        EXPECT_EQ(moved.GetStringView("route"), "orders");
+
+        jsonWrapper = std::move(copy);
+        EXPECT_EQ(jsonWrapper.GetStringView("route"), "orders");
+    }
+}
+
+TYPED_TEST(TestIJsonWrapper, DocumentCache)
+{
+    if (!this->_jsonWrapper.AllowsConcurrentReads())
+    {
+        EXPECT_THROW(Wrappers::JsonDocumentCache([] { return std::make_unique<TypeParam>(); }), Wrappers::XJsonError);
+        return;
+    }
+
+    Wrappers::JsonDocumentCache cache{[] { return std::make_unique<TypeParam>(); }, {2, 1}};
+
+    const std::shared_ptr<const Wrappers::IJsonWrapper> first = cache.Parse(R"({"id": 1})");
+    EXPECT_EQ(first->GetInt("id"), 1);
+    EXPECT_EQ(cache.Parse(R"({"id": 1})"), first);
+    EXPECT_NE(cache.Parse(R"({"id": 2})"), first);
+
+    // the least recently used document is evicted, but stays valid for its holders
+    cache.Parse(R"({"id": 1})");
+    cache.Parse(R"({"id": 3})");
+    EXPECT_EQ(cache.Size(), 2U);
+    EXPECT_EQ(cache.Parse(R"({"id": 1})"), first);
+    const std::shared_ptr<const Wrappers::IJsonWrapper> second = cache.Parse(R"({"id": 2})");
+    EXPECT_EQ(second->GetInt("id"), 2);
+
+    Wrappers::JsonCacheStatistics statistics = cache.Statistics();
+    EXPECT_EQ(statistics.hits, 3U);
+    EXPECT_EQ(statistics.misses, 4U);
+    EXPECT_EQ(statistics.evictions, 2U);
+
+    EXPECT_THROW(cache.Parse("{"), Wrappers::XJsonError);
+    EXPECT_EQ(cache.Size(), 2U);
+
+    cache.Clear();
+    EXPECT_EQ(cache.Size(), 0U);
+    EXPECT_EQ(first->GetInt("id"), 1);
+
+    EXPECT_THROW(Wrappers::JsonDocumentCache(nullptr), Wrappers::XJsonError);
+    EXPECT_THROW(Wrappers::JsonDocumentCache([] { return std::make_unique<TypeParam>(); }, {0, 1}),
+                 Wrappers::XJsonError);
+
+    // workers sharing the cache get one document per text
+    Wrappers::JsonDocumentCache shared{[] { return std::make_unique<TypeParam>(); }};
+    constexpr int kThreadCount = 4;
+    constexpr int kLookupCount = 200;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < kThreadCount; ++t)
+    {
+        workers.emplace_back([&shared] {
+            for (int i = 0; i < kLookupCount; ++i)
+            {
+                ASSERT_NE(shared.Parse("{\"id\": " + std::to_string(i % 10) + "}"), nullptr);
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    statistics = shared.Statistics();
+    EXPECT_EQ(shared.Size(), 10U);
+    EXPECT_EQ(statistics.hits + statistics.misses, static_cast<uint64_t>(kThreadCount * kLookupCount));
+    EXPECT_EQ(statistics.evictions, 0U);
+}
+
+TYPED_TEST(TestIJsonWrapper, ParseBatch)
+{
+    const Wrappers::JsonWrapperFactory factory = [] { return std::make_unique<TypeParam>(); };
+
+    std::vector<std::string> texts;
+    for (int i = 0; i < 100; ++i)
+    {
+        texts.push_back("{\"index\": " + std::to_string(i) + "}");
+    }
+    std::vector<std::string_view> views(texts.begin(), texts.end());
+
+    const std::vector<std::unique_ptr<Wrappers::IJsonWrapper>> documents =
+        Wrappers::ParseBatch(factory, views.data(), views.size(), {4, 8});
+    ASSERT_EQ(documents.size(), texts.size());
+    for (std::size_t i = 0; i < documents.size(); ++i)
+    {
+        EXPECT_EQ(documents[i]->GetInt("index"), static_cast<int64_t>(i));
+    }
+
+    EXPECT_TRUE(Wrappers::ParseBatch(factory, nullptr, 0).empty());
+
+    views[57] = "{\"index\": ";
+    try
+    {
+        Wrappers::ParseBatch(factory, views.data(), views.size(), {4, 8});
+        FAIL() << "a broken document must fail the batch";
+    }
+    catch (const Wrappers::XJsonError& e)
+    {
+        EXPECT_NE(std::string{e.what()}.find("document 57"), std::string::npos);
+    }
+
+    // batches from several threads at once: one uses the kept helpers, the others start their own
+    views[57] = texts[57];
+    std::vector<std::thread> callers;
+    std::atomic<std::size_t> parsed{0};
+    for (int caller = 0; caller < 3; ++caller)
+    {
+        callers.emplace_back([&] {
+            for (int batch = 0; batch < 5; ++batch)
+            {
+                parsed += Wrappers::ParseBatch(factory, views.data(), views.size(), {4, 8}).size();
+            }
+        });
+    }
+    for (std::thread& caller : callers)
+    {
+        caller.join();
+    }
+    EXPECT_EQ(parsed.load(), 15 * texts.size());
+}
+
+TYPED_TEST(TestIJsonWrapper, SerializeParallel)
+{
+    std::string members;
+    for (int i = 0; i < 200; ++i)
+    {
+        members += (0 == i ? "" : ",");
+        members += "\"key" + std::to_string(199 - i) + "\": {\"id\": " + std::to_string(i) +
+                   ", \"name\": \"caf\\u00e9 \\\"" + std::to_string(i) + "\\\"\", \"tags\": [1, 2.5, true, null]}";
+    }
+    const std::vector<std::string> documents = {
+        "{" + members + "}",
+        "{\"data\": {" + members + "}}",
+        "[[{\"a\": 1}, [], {}, \"x\", -3, 1e10]]",
+        "{}",
+        "[]",
+        "\"scalar\"",
+    };
+
+    for (const std::string& text : documents)
+    {
+        TypeParam json;
+        json.Parse(text);
+        const std::string expected = json.ToString();
+
+        for (const std::size_t threadCount : {std::size_t{1}, std::size_t{4}})
+        {
+            std::string output = "stale";
+            json.SerializeParallel(output, threadCount);
+            EXPECT_EQ(output, expected) << text;
+
+            std::vector<std::string> pieces;
+            json.SerializeParallel(pieces, threadCount);
+            std::string joined;
+            for (const std::string& piece : pieces)
+            {
+                joined += piece;
+            }
+            EXPECT_EQ(joined, expected) << text;
+        }
+    }
+
+    TypeParam lazy;
+    lazy.ParseLazy(documents.front());
+    std::string output;
+    lazy.SerializeParallel(output, 4);
+    EXPECT_EQ(output, lazy.ToString());
+}
+
+TYPED_TEST(TestIJsonWrapper, BinaryRoundTrip)
+{
+    TypeParam json;
+    json.Parse(R"({"id": 18446744073709551615, "delta": -42, "ratio": 0.1, "huge": 1e300, "small": 1.5,
+                   "name": "café \"quoted\"", "ok": true, "none": null, "empty": {}, "list": [],
+                   "nested": {"values": [1, -2, 3.25, "x", [false]]}})");
+    const std::string expected = json.ToString();
+
+    for (const Wrappers::JsonBinaryFormat format : {Wrappers::JsonBinaryFormat::Cbor,
+                                                    Wrappers::JsonBinaryFormat::MessagePack})
+    {
+        const std::vector<std::uint8_t> bytes = json.ToBinary(format);
+        EXPECT_LT(bytes.size(), expected.size());
+
+        TypeParam decoded;
+        decoded.ParseBinary(format, bytes.data(), bytes.size());
+        EXPECT_EQ(decoded.ToString(), expected);
+
+        // any backend reads the bytes of any other
+        Wrappers::NlohmannJsonWrapper reference;
+        reference.ParseBinary(format, bytes.data(), bytes.size());
+        EXPECT_EQ(reference.ToString(), expected);
+        EXPECT_EQ(reference.ToBinary(format), bytes);
+
+        EXPECT_THROW(decoded.ParseBinary(format, bytes.data(), bytes.size() - 1), Wrappers::XJsonError);
+    }
+
+    // a CBOR byte string has no JSON counterpart
+    const std::vector<std::uint8_t> byteString = {0x41, 0x01};
+    EXPECT_THROW(json.ParseBinary(Wrappers::JsonBinaryFormat::Cbor, byteString.data(), byteString.size()),
+                 Wrappers::XJsonError);
+}
+
+TYPED_TEST(TestIJsonWrapper, KeyHandles)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    const Wrappers::JsonKey id{"id"};
+    const Wrappers::JsonKey name{"name"};
+    const Wrappers::JsonKey quoted{"say \"hi\""};
+    const Wrappers::JsonKey missing{"missing"};
+
+    EXPECT_EQ(Wrappers::JsonKey{"id"}, id);
+    EXPECT_EQ(Wrappers::JsonKey{std::string{"id"}}.Name().data(), id.Name().data());
+    EXPECT_NE(id, name);
+
+    jsonWrapper.Parse(R"({"id": 7, "name": "x", "say \"hi\"": true, "none": null, "nested": {"id": 1}})");
+
+    EXPECT_EQ(jsonWrapper.GetInt(id), 7);
+    EXPECT_EQ(jsonWrapper.GetUnsigned(id), 7U);
+    EXPECT_EQ(jsonWrapper.GetStringView(name), "x");
+    EXPECT_EQ(jsonWrapper.GetString(name), "x");
+    EXPECT_TRUE(jsonWrapper.GetBool(quoted));
+    EXPECT_TRUE(jsonWrapper.IsNull(Wrappers::JsonKey{"none"}));
+    EXPECT_TRUE(jsonWrapper.HasKey(name));
+    EXPECT_FALSE(jsonWrapper.HasKey(missing));
+    EXPECT_THROW(jsonWrapper.GetInt(missing), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.GetInt(name), Wrappers::XJsonError);
+
+    // setters, by handle or by name, are seen by later lookups
+    jsonWrapper.SetInt(id, 8);
+    jsonWrapper.SetString("name", "y");
+    jsonWrapper.SetDouble(missing, 0.5);
+
+    EXPECT_EQ(jsonWrapper.GetInt(id), 8);
+    EXPECT_EQ(jsonWrapper.GetStringView(name), "y");
+    EXPECT_EQ(jsonWrapper.GetDouble(missing), 0.5);
+
+    jsonWrapper.Parse(R"({"name": "z"})");
+    EXPECT_FALSE(jsonWrapper.HasKey(id));
+    EXPECT_EQ(jsonWrapper.GetStringView(name), "z");
+
+    jsonWrapper.Parse("[1, 2]");
+    EXPECT_FALSE(jsonWrapper.HasKey(name));
+}
+
+TYPED_TEST(TestIJsonWrapper, FeedParser)
+{
+    const std::string json = R"( {"id": 7, "name": "a \"quoted\" }, name",
+                                 "kéy": [1, {"x": "]"}], "nested": {"deep": {"list": [true, null]}},
+                                 "score": 2.5, "empty": {}, "t\u0061g": "v"} )";
+
+    TypeParam expected;
+    expected.Parse(json);
+
+    for (const std::size_t chunkSize : {std::size_t{1}, std::size_t{7}, json.size()})
+    {
+        TypeParam jsonWrapper;
+        jsonWrapper.SetInt("stale", 1);
+
+        Wrappers::JsonFeedParser parser{jsonWrapper};
+        for (std::size_t offset = 0; offset < json.size(); offset += chunkSize)
+        {
+            parser.Feed(std::string_view{json}.substr(offset, chunkSize));
+        }
+        parser.Finish();
+
+        EXPECT_EQ(jsonWrapper.ToString(), expected.ToString());
+        EXPECT_EQ(jsonWrapper.GetStringView("name"), "a \"quoted\" }, name");
+        EXPECT_FALSE(jsonWrapper.HasKey("stale"));
+        EXPECT_THROW(parser.Feed("{}"), Wrappers::XJsonError);
+    }
+
+    {
+        // the members and elements that arrived can be read before the document is complete
+        TypeParam jsonWrapper;
+        Wrappers::JsonFeedParser parser{jsonWrapper};
+        parser.Feed(R"({"id": 7, "name": "x", "rest": [1, )");
+
+        EXPECT_EQ(jsonWrapper.GetInt("id"), 7);
+        EXPECT_EQ(jsonWrapper.GetStringView("name"), "x");
+        EXPECT_EQ(jsonWrapper.ToString(), R"({"id":7,"name":"x","rest":[1]})");
+
+        parser.Feed("2]}");
+        parser.Finish();
+        EXPECT_EQ(jsonWrapper.ToString(), R"({"id":7,"name":"x","rest":[1,2]})");
+    }
+
+    {
+        // a root array is appended element by element, any other root is parsed whole
+        TypeParam jsonWrapper;
+        Wrappers::JsonFeedParser parser{jsonWrapper};
+        parser.Feed("[1, 2");
+        EXPECT_EQ(jsonWrapper.ToString(), "[1]");
+        parser.Feed(", 3]");
+        parser.Finish();
+        EXPECT_EQ(jsonWrapper.ToString(), "[1,2,3]");
+
+        Wrappers::JsonFeedParser scalarParser{jsonWrapper};
+        scalarParser.Feed(R"("a )");
+        scalarParser.Feed(R"(b")");
+        scalarParser.Finish();
+        EXPECT_EQ(jsonWrapper.ToString(), R"("a b")");
+    }
+
+    for (const std::string_view malformed : {R"({"a": 1)",
+                                             R"({"a" 1})",
+                                             R"({"a": })",
+                                             R"({"a": 1} x)",
+                                             "  ",
+                                             "[1, ",
+                                             "[1}",
+                                             "[1,]",
+                                             "[1 2]",
+                                             "[1] x",
+                                             R"({"a": [1,]})",
+                                             R"({"a": [1} })",
+                                             R"({"a": [1] 2})",
+                                             R"({"a": [[}]]})"})
+    {
+        // whole, and byte by byte so that arrays are split
+        for (const std::size_t chunkSize : {malformed.size(), std::size_t{1}})
+        {
+            TypeParam jsonWrapper;
+            Wrappers::JsonFeedParser parser{jsonWrapper};
+            EXPECT_THROW(
+                {
+                    for (std::size_t offset = 0; offset < malformed.size(); offset += chunkSize)
+                    {
+                        parser.Feed(malformed.substr(offset, chunkSize));
+                    }
+                    parser.Finish();
+                },
+                Wrappers::XJsonError)
+                << malformed << " in chunks of " << chunkSize;
+        }
+    }
+}
+
+TYPED_TEST(TestIJsonWrapper, FeedParserArrays)
+{
+    std::string json = R"({"head": 1, "items": [)";
+    for (int i = 0; i < 50; ++i)
+    {
+        json += (0 == i) ? "" : " , ";
+        json += R"({"id": )" + std::to_string(i) + R"(, "tags": ["a,]", [)" + std::to_string(i) + "]]}";
+    }
+    json += R"(], "empty": [ ], "tail": [[], "x"]})";
+
+    TypeParam expected;
+    expected.Parse(json);
+
+    for (const std::size_t chunkSize : {std::size_t{1}, std::size_t{13}, json.size()})
+    {
+        TypeParam jsonWrapper;
+        Wrappers::JsonFeedParser parser{jsonWrapper};
+        for (std::size_t offset = 0; offset < json.size(); offset += chunkSize)
+        {
+            parser.Feed(std::string_view{json}.substr(offset, chunkSize));
+        }
+        parser.Finish();
+
+        EXPECT_EQ(jsonWrapper.ToString(), expected.ToString()) << "chunks of " << chunkSize;
+        EXPECT_EQ(jsonWrapper.GetInt(Wrappers::JsonPath{"/items/49/tags/1/0"}), 49);
+        EXPECT_EQ(jsonWrapper.GetStringView(Wrappers::JsonPath{"/tail/1"}), "x");
+    }
+
+    {
+        // a repeated key read after a split array gives the last value, as from a parsed text
+        const std::string repeated = R"({"a": [1, 2], "b": 0, "a": [3, 4]})";
+        TypeParam reference;
+        reference.Parse(repeated);
+
+        TypeParam jsonWrapper;
+        Wrappers::JsonFeedParser parser{jsonWrapper};
+        for (std::size_t offset = 0; offset < repeated.size(); ++offset)
+        {
+            parser.Feed(std::string_view{repeated}.substr(offset, 1));
+        }
+        parser.Finish();
+        EXPECT_EQ(jsonWrapper.ToString(), reference.ToString());
+        EXPECT_EQ(jsonWrapper.GetInt(Wrappers::JsonPath{"/a/1"}), 4);
+    }
+
+    {
+        // the elements of a root array are readable as they complete
+        const std::string root = "[" + json + ", 2, [3]]";
+        expected.Parse(root);
+
+        TypeParam jsonWrapper;
+        Wrappers::JsonFeedParser parser{jsonWrapper};
+        parser.Feed(std::string_view{root}.substr(0, root.size() - 5));
+        EXPECT_EQ(jsonWrapper.GetInt(Wrappers::JsonPath{"/0/head"}), 1);
+        parser.Feed(std::string_view{root}.substr(root.size() - 5));
+        parser.Finish();
+        EXPECT_EQ(jsonWrapper.ToString(), expected.ToString());
+    }
+}
+
+TYPED_TEST(TestIJsonWrapper, StreamingWriter)
+{
+    // keys in sorted order, the order every backend serializes them in
+    TypeParam expected;
+    expected.Parse(R"({"big": 18446744073709551615, "id": -7, "items": [{"ok": true}, [], null, 2.5, 1e-05],
+                       "name": "a \"quoted\" é", "none": {}, "score": 100.0})");
+
+    TypeParam child;
+    child.Parse(R"({"ok": true})");
+
+    const auto write = [&child](Wrappers::JsonWriter& writer) {
+        writer.BeginObject();
+        writer.Key("big");
+        writer.Unsigned(std::numeric_limits<uint64_t>::max());
+        writer.Key("id");
+        writer.Int(-7);
+        writer.Key("items");
+        writer.BeginArray();
+        writer.Embed(child);
+        writer.BeginArray();
+        writer.EndArray();
+        writer.Null();
+        writer.Double(2.5);
+        writer.Double(0.00001);
+        writer.EndArray();
+        writer.Key("name");
+        writer.String("a \"quoted\" \xc3\xa9");
+        writer.Key("none");
+        writer.BeginObject();
+        writer.EndObject();
+        writer.Key("score");
+        writer.Double(100.0);
+        writer.EndObject();
+        return writer.Finish();
+    };
+
+    const std::string text = expected.ToString();
+
+    std::string output = "prefix:";
+    {
+        Wrappers::JsonWriter writer{output};
+        EXPECT_EQ(write(writer), text.size());
+    }
+    EXPECT_EQ(output, "prefix:" + text);
+
+    std::vector<char> buffer(text.size());
+    {
+        Wrappers::JsonWriter writer{buffer.data(), buffer.size()};
+        EXPECT_EQ(write(writer), text.size());
+    }
+    EXPECT_EQ(std::string_view(buffer.data(), buffer.size()), text);
+
+    {
+        // a short buffer still counts the whole document
+        Wrappers::JsonWriter writer{buffer.data(), 4};
+        EXPECT_EQ(write(writer), text.size());
+    }
+
+    {
+        Wrappers::JsonWriter writer{output};
+        writer.Bool(false);
+        EXPECT_EQ(writer.Finish(), 5);
+        EXPECT_THROW(writer.Int(1), Wrappers::XJsonError);
+    }
+
+    std::string misuse;
+    Wrappers::JsonWriter writer{misuse};
+    EXPECT_THROW(writer.Key("a"), Wrappers::XJsonError);
+    EXPECT_THROW(writer.Finish(), Wrappers::XJsonError);
+    writer.BeginObject();
+    EXPECT_THROW(writer.Int(1), Wrappers::XJsonError);
+    EXPECT_THROW(writer.EndArray(), Wrappers::XJsonError);
+    writer.Key("a");
+    EXPECT_THROW(writer.Key("b"), Wrappers::XJsonError);
+    EXPECT_THROW(writer.EndObject(), Wrappers::XJsonError);
+    writer.BeginArray();
+    EXPECT_THROW(writer.Key("c"), Wrappers::XJsonError);
+    EXPECT_THROW(writer.EndObject(), Wrappers::XJsonError);
+    EXPECT_THROW(writer.String("\xff"), Wrappers::XJsonError);
+}
+
+TYPED_TEST(TestIJsonWrapper, CrossBackendSetObject)
+{
+    const std::string childJson = R"({"array":[1,-2,18446744073709551615,2.5,true,null,"s"],"empty":{},)"
+                                  R"("nested":{"deep":[[],{}],"text":"a \"quoted\"\n\u00e9"},"none":null})";
+
+    TypeParam expected;
+    expected.Parse(childJson);
+
+    for (const std::string& name : Wrappers::JsonBackendRegistry::Instance().Names())
+    {
+        SCOPED_TRACE(name);
+
+        std::unique_ptr<Wrappers::IJsonWrapper> child = Wrappers::JsonBackendRegistry::Instance().Create(name);
+        child->Parse(childJson);
+
+        TypeParam parent;
+        parent.Parse(R"({"child":1,"kept":"yes"})");
+        parent.SetObject("child", std::move(child));
+
+        EXPECT_EQ(parent.GetObject("child")->ToString(), expected.ToString());
+        EXPECT_EQ(parent.GetString("kept"), "yes");
+
+        std::unique_ptr<Wrappers::IJsonWrapper> scalar = Wrappers::JsonBackendRegistry::Instance().Create(name);
+        scalar->Parse("-7");
+        parent.SetObject("scalar", std::move(scalar));
+        EXPECT_EQ(parent.GetInt("scalar"), -7);
+    }
+}
+
+TYPED_TEST(TestIJsonWrapper, BackendRegistry)
+{
+    Wrappers::JsonBackendRegistry registry;
+    EXPECT_TRUE(registry.Names().empty());
+    EXPECT_EQ(registry.PreferredName(Wrappers::JsonWorkload::ReadMostly), "nlohmann");
+    EXPECT_THROW(registry.Create("custom"), Wrappers::XJsonError);
+    EXPECT_THROW(registry.Create(Wrappers::JsonWorkload::General), Wrappers::XJsonError);
+    EXPECT_THROW(registry.Prefer(Wrappers::JsonWorkload::General, "custom"), Wrappers::XJsonError);
+    EXPECT_THROW(registry.Register("", [](std::pmr::memory_resource*) { return std::make_unique<TypeParam>(); }),
+                 Wrappers::XJsonError);
+    EXPECT_THROW(registry.Register("custom", nullptr), Wrappers::XJsonError);
+
+    registry.Register("custom", [](std::pmr::memory_resource*) { return std::make_unique<TypeParam>(); });
+    registry.Register("another", [](std::pmr::memory_resource*) { return std::make_unique<TypeParam>(); });
+    registry.Prefer(Wrappers::JsonWorkload::WriteHeavy, "custom");
+    EXPECT_TRUE(registry.Contains("custom"));
+    EXPECT_FALSE(registry.Contains("missing"));
+    EXPECT_EQ(registry.Names(), (std::vector<std::string>{"another", "custom"}));
+    EXPECT_EQ(registry.PreferredName(Wrappers::JsonWorkload::WriteHeavy), "custom");
+
+    std::unique_ptr<Wrappers::IJsonWrapper> created = registry.Create(Wrappers::JsonWorkload::WriteHeavy);
+    ASSERT_NE(dynamic_cast<TypeParam*>(created.get()), nullptr);
+    created->Parse(R"({"a":1})");
+    EXPECT_EQ(created->GetInt("a"), 1);
+
+    const Wrappers::JsonWrapperFactory factory = registry.MakeFactory("custom");
+    EXPECT_NE(dynamic_cast<TypeParam*>(factory().get()), nullptr);
+    EXPECT_THROW(registry.MakeFactory("missing"), Wrappers::XJsonError);
+
+    const Wrappers::JsonBackendRegistry& builtins = Wrappers::JsonBackendRegistry::Instance();
+    EXPECT_EQ(builtins.PreferredName(Wrappers::JsonWorkload::General), "nlohmann");
+    EXPECT_EQ(builtins.PreferredName(Wrappers::JsonWorkload::ReadMostly), "simdjson");
+    EXPECT_EQ(builtins.PreferredName(Wrappers::JsonWorkload::LowMemory), "nlohmann-flat");
+    EXPECT_NE(dynamic_cast<Wrappers::SimdJsonWrapper*>(builtins.Create(Wrappers::JsonWorkload::ReadMostly).get()),
+              nullptr);
+
+    // documents shared between threads need a backend that allows concurrent reads
+    EXPECT_EQ(builtins.PreferredName(Wrappers::JsonWorkload::SharedReads), "nlohmann");
+    EXPECT_NO_THROW(Wrappers::JsonDocumentCache{builtins.MakeFactory(Wrappers::JsonWorkload::SharedReads)});
+    EXPECT_THROW(Wrappers::JsonDocumentCache{builtins.MakeFactory(Wrappers::JsonWorkload::ReadMostly)},
+                 Wrappers::XJsonError);
+    if (created->AllowsConcurrentReads())
+    {
+        registry.Prefer(Wrappers::JsonWorkload::SharedReads, "custom");
+        EXPECT_EQ(registry.PreferredName(Wrappers::JsonWorkload::SharedReads), "custom");
+    }
+    else
+    {
+        EXPECT_THROW(registry.Prefer(Wrappers::JsonWorkload::SharedReads, "custom"), Wrappers::XJsonError);
+    }
+
+    std::pmr::monotonic_buffer_resource resource;
+    std::unique_ptr<Wrappers::IJsonWrapper> pooled = builtins.Create("nlohmann", &resource);
+    pooled->Parse(R"({"b":[true]})");
+    EXPECT_EQ(pooled->ToString(), R"({"b":[true]})");
+}
+
+TYPED_TEST(TestIJsonWrapper, EscapedKeys)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    jsonWrapper.Parse(R"({"a\"b": 1, "tab\tkey": "x", "A": true, "nested": {"c\\d": 2, "plain": 3}})");
+
+    EXPECT_EQ(jsonWrapper.GetInt("a\"b"), 1);
+    EXPECT_EQ(jsonWrapper.GetStringView("tab\tkey"), "x");
+    EXPECT_TRUE(jsonWrapper.GetBool("A"));
+    EXPECT_TRUE(jsonWrapper.HasKey("a\"b"));
+    EXPECT_FALSE(jsonWrapper.HasKey(R"(a\"b)"));
+    EXPECT_EQ(jsonWrapper.GetObject("nested")->GetInt("c\\d"), 2);
+
+    const Wrappers::JsonView nested = jsonWrapper.GetObjectView("nested");
+    EXPECT_EQ(nested.GetInt("c\\d"), 2);
+    EXPECT_EQ(nested.GetInt("plain"), 3);
+    EXPECT_FALSE(nested.HasKey(R"(c\\d)"));
+    EXPECT_EQ(jsonWrapper.GetInt(Wrappers::JsonPath{"/nested/c\\d"}), 2);
+}
+
+TYPED_TEST(TestIJsonWrapper, DuplicateKeys)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    // the last value wins, as in the serialized text
+    jsonWrapper.Parse(R"({"k": 1, "other": 0, "k": 2, "nested": {"n": "a", "n": "b"}})");
+
+    EXPECT_EQ(jsonWrapper.GetInt("k"), 2);
+    EXPECT_EQ(jsonWrapper.GetInt(Wrappers::JsonKey{"k"}), 2);
+    EXPECT_EQ(jsonWrapper.GetObjectView("nested").GetStringView("n"), "b");
+    EXPECT_EQ(jsonWrapper.GetStringView(Wrappers::JsonPath{"nested.n"}), "b");
+    EXPECT_EQ(jsonWrapper.ToString(), R"({"k":2,"nested":{"n":"b"},"other":0})");
+
+    jsonWrapper.SetInt("k", 3);
+    EXPECT_EQ(jsonWrapper.GetInt("k"), 3);
+    EXPECT_EQ(jsonWrapper.ToString(), R"({"k":3,"nested":{"n":"b"},"other":0})");
+}
+
+TYPED_TEST(TestIJsonWrapper, MalformedValueRejectedByParse)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    EXPECT_THROW(jsonWrapper.Parse(R"({"ok": 1, "number": -, "atom": nul, "list": [tru]})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"({"n": -})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"({"a": nul})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"({"b": nullx})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"({"b": [truex]})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"({"b": {"c": fals}})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"({"x": 01})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"({"x": 1.})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"({"x": 1e})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"({"x": +1})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse("nullx"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse("-"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"({"a": 1,})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"({"a" 1})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"([1 2])"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"(1 2)"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"({"a": "\q"})"), Wrappers::XJsonError);
+    EXPECT_THROW(jsonWrapper.Parse(R"({"a": "\u12"})"), Wrappers::XJsonError);
+
+    jsonWrapper.Parse(R"({"n": null , "z": -0, "e": 1.5E+3, "f": 2e-2, "t": true, "big": 123456789012345678901234})");
+    EXPECT_TRUE(jsonWrapper.IsNull("n"));
+    EXPECT_EQ(jsonWrapper.GetInt("z"), 0);
+    EXPECT_DOUBLE_EQ(jsonWrapper.GetDouble("e"), 1500.0);
+    EXPECT_DOUBLE_EQ(jsonWrapper.GetDouble("f"), 0.02);
+    EXPECT_TRUE(jsonWrapper.GetBool("t"));
+}
+
+TYPED_TEST(TestIJsonWrapper, SetMembersOfParsedDocument)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    jsonWrapper.Parse(R"( { "a" : 1 , "b\"" : [1, 2] , "c": {"d": "x"} }  )");
+
+    // replaced values change length, and enough members are added for the text to move
+    jsonWrapper.SetString("a", "a value longer than the one it replaces");
+    jsonWrapper.SetInt("b\"", 7);
+    for (int64_t i = 0; i < 64; ++i)
+    {
+        jsonWrapper.SetInt("k" + std::to_string(i), i);
+    }
+    jsonWrapper.SetString("tab\t", "v");
+    jsonWrapper.SetInt("a", 2);
+
+    EXPECT_EQ(jsonWrapper.GetInt("a"), 2);
+    EXPECT_EQ(jsonWrapper.GetInt("b\""), 7);
+    EXPECT_EQ(jsonWrapper.GetObjectView("c").GetStringView("d"), "x");
+    EXPECT_EQ(jsonWrapper.GetInt("k0"), 0);
+    EXPECT_EQ(jsonWrapper.GetInt(Wrappers::JsonKey{"k63"}), 63);
+    EXPECT_EQ(jsonWrapper.GetStringView("tab\t"), "v");
+
+    TypeParam reparsed;
+    reparsed.Parse(jsonWrapper.ToString());
+    EXPECT_EQ(reparsed.ToString(), jsonWrapper.ToString());
+    EXPECT_EQ(reparsed.GetInt("k31"), 31);
+
+    std::unique_ptr<Wrappers::IJsonWrapper> empty = jsonWrapper.GetEmptyObject();
+    empty->SetBool("first", true);
+    empty->SetNull("second");
+    EXPECT_EQ(empty->ToString(), R"({"first":true,"second":null})");
+
+    jsonWrapper.Parse("[1]");
+    EXPECT_THROW(jsonWrapper.SetInt("a", 1), Wrappers::XJsonError);
+}
+
+TYPED_TEST(TestIJsonWrapper, RepeatedNestedReads)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    const auto generate = [](bool reversed) {
+        std::string json = R"({"items": [)";
+        for (int i = 0; i < 32; ++i)
+        {
+            const std::string tag = "t" + std::to_string(reversed ? 31 - i : i);
+            json += (0 == i) ? "" : ",";
+            json += R"({"id": )" + std::to_string(i) + R"(, "tags": [")" + tag + R"("]})";
+        }
+        return json + "]}";
+    };
+    jsonWrapper.Parse(generate(false));
+
+    // interleaves more objects and arrays than are kept iterated at once
+    const Wrappers::JsonView items = jsonWrapper.GetArrayView("items");
+    for (std::size_t round = 0; round < 2; ++round)
+    {
+        for (std::size_t i = 0; i < items.Size(); ++i)
+        {
+            const Wrappers::JsonView item = items.Element(i);
+            EXPECT_EQ(item.GetInt("id"), static_cast<int64_t>(i));
+            EXPECT_EQ(item.GetArrayView("tags").Element(0).AsStringView(), "t" + std::to_string(i));
+            EXPECT_EQ(items.Element(31 - i).GetInt("id"), static_cast<int64_t>(31 - i));
+            EXPECT_EQ(item.GetInt("id"), static_cast<int64_t>(i));
+        }
+    }
+    EXPECT_THROW(items.Element(32), Wrappers::XJsonError);
+
+    // a document of the same size lands at the same address, with its values elsewhere; nothing read before may
+    // be served from it
+    jsonWrapper.Parse(generate(true));
+    const Wrappers::JsonView reversedItems = jsonWrapper.GetArrayView("items");
+    EXPECT_EQ(reversedItems.Element(3).GetArrayView("tags").Element(0).AsStringView(), "t28");
+    EXPECT_EQ(reversedItems.Element(20).GetInt("id"), 20);
+
+    jsonWrapper.SetInt("items", 1);
+    EXPECT_EQ(jsonWrapper.GetInt("items"), 1);
+}
+
+TYPED_TEST(TestIJsonWrapper, RepeatedEscapedStringReads)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    jsonWrapper.Parse(R"({"s": "a\"b", "nested": {"t": "c\nd"}})");
+
+    // reading a string with escapes again hands out the same storage instead of a new copy
+    const std::string_view first = jsonWrapper.GetStringView("s");
+    const std::string_view nested = jsonWrapper.GetStringView(Wrappers::JsonPath{"/nested/t"});
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(jsonWrapper.GetStringView("s").data(), first.data());
+        EXPECT_EQ(jsonWrapper.TryGetStringView("s").Value().data(), first.data());
+        EXPECT_EQ(jsonWrapper.GetStringView(Wrappers::JsonPath{"/nested/t"}).data(), nested.data());
+        EXPECT_EQ(jsonWrapper.GetString("s"), "a\"b");
+    }
+    EXPECT_EQ(first, "a\"b");
+    EXPECT_EQ(nested, "c\nd");
+
+    jsonWrapper.SetString("s", "e\\f");
+    EXPECT_EQ(jsonWrapper.GetStringView("s"), "e\\f");
+    EXPECT_EQ(jsonWrapper.GetStringView(Wrappers::JsonPath{"/nested/t"}), "c\nd");
+}
+
+TYPED_TEST(TestIJsonWrapper, PlacementNew)
+{
+    alignas(TypeParam) std::byte storage[sizeof(TypeParam)];
+
+    TypeParam* jsonWrapper = new (storage) TypeParam{};
+    jsonWrapper->Parse(R"({"id": 3})");
+    EXPECT_EQ(jsonWrapper->GetInt("id"), 3);
+    jsonWrapper->~TypeParam();
+}
+
+TYPED_TEST(TestIJsonWrapper, WideObject)
+{
+    Wrappers::IJsonWrapper& jsonWrapper = this->_jsonWrapper;
+
+    // keys of different lengths in no particular order, more than any backend scans linearly
+    std::string json = "{";
+    for (int i = 0; i < 100; ++i)
+    {
+        const int id = i * 37 % 100;
+        json += (0 == i) ? "" : ",";
+        json += "\"key" + std::to_string(id) + "\": " + std::to_string(id);
+    }
+    jsonWrapper.Parse(json + "}");
+
+    for (int id = 0; id < 100; ++id)
+    {
+        EXPECT_EQ(jsonWrapper.GetInt("key" + std::to_string(id)), id);
+    }
+    EXPECT_FALSE(jsonWrapper.HasKey("key100"));
+    EXPECT_FALSE(jsonWrapper.HasKey("key"));
+    EXPECT_FALSE(jsonWrapper.HasKey(""));
+
+    jsonWrapper.SetInt("key50", -50);
+    jsonWrapper.SetInt("a", 1);
+    jsonWrapper.SetInt("z", 2);
+    EXPECT_EQ(jsonWrapper.GetInt("key50"), -50);
+    EXPECT_EQ(jsonWrapper.GetInt("a"), 1);
+    EXPECT_EQ(jsonWrapper.GetInt("z"), 2);
+    EXPECT_EQ(jsonWrapper.GetInt("key99"), 99);
+
+    // serialized with the members sorted by key, whatever the backend keeps
+    const std::string text = jsonWrapper.ToString();
+    EXPECT_EQ(text.rfind("{\"a\":1,\"key0\":0,\"key1\":1,\"key10\":10,", 0), 0U);
+    EXPECT_NE(text.find("\"key50\":-50,"), std::string::npos);
+    EXPECT_EQ(text.substr(text.size() - 7), ",\"z\":2}");
+}
+
+TYPED_TEST(TestIJsonWrapper, ParseLazyConcurrentReads)
+{
+    if constexpr (std::is_same_v<TypeParam, Wrappers::SimdJsonWrapper>)
+    {
+        GTEST_SKIP() << "The backend's getters may not run concurrently.";
+    }
+    else
+    {
+        constexpr int kMemberCount = 64;
+        constexpr int kThreadCount = 4;
+
+        // the text is borrowed, not copied, and must outlive lazy mode
+        std::string json = "{";
+        for (int i = 0; i < kMemberCount; ++i)
+        {
+            json += (0 == i) ? "" : ",";
+            json += "\"m" + std::to_string(i) + "\": {\"id\": " + std::to_string(i) + "}";
+        }
+        json += "}";
+
+        TypeParam reference;
+        reference.Parse(json);
+        const std::string expected = reference.ToString();
+
+        TypeParam jsonWrapper;
+        jsonWrapper.ParseLazy(json);
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < kThreadCount; ++t)
+        {
+            workers.emplace_back([&jsonWrapper, &expected, t] {
+                // every thread starts at a different member; one decodes the whole document midway
+                for (int i = 0; i < kMemberCount; ++i)
+                {
+                    const int id = (i + t * kMemberCount / kThreadCount) % kMemberCount;
+                    EXPECT_EQ(jsonWrapper.GetInt(Wrappers::JsonPath{"/m" + std::to_string(id) + "/id"}), id);
+                    EXPECT_EQ(jsonWrapper.GetObjectView("m" + std::to_string(id)).GetInt("id"), id);
+                    EXPECT_TRUE(jsonWrapper.HasKey("m" + std::to_string(id)));
+                    if (0 == t && kMemberCount / 2 == i)
+                    {
+                        EXPECT_EQ(jsonWrapper.ToString(), expected);
+                    }
+                }
+            });
+        }
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+        EXPECT_EQ(jsonWrapper.ToString(), expected);
+
+        // a malformed value fails every read, not only the first one
+        jsonWrapper.ParseLazy(R"({"good": 1, "bad": tru})");
+        EXPECT_THROW(jsonWrapper.GetBool("bad"), Wrappers::XJsonError);
+        EXPECT_THROW(jsonWrapper.GetBool("bad"), Wrappers::XJsonError);
+        EXPECT_EQ(jsonWrapper.GetInt("good"), 1);
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef _INCLUDE_JSON_WRAPPER_DETAILS_JSONBINARYCODEC_HPP_
+#define _INCLUDE_JSON_WRAPPER_DETAILS_JSONBINARYCODEC_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Interfaces/JsonBinaryFormat.hpp"
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        /**
+         * @brief Encode a JSON text in a binary format, for backends without a binary codec of their own.
+         * @throw XJsonError If `json` is not valid JSON.
+         */
+        std::vector<std::uint8_t> TextToBinary(std::string_view json, JsonBinaryFormat format);
+
+        /**
+         * @brief Decode a binary document into JSON text, streamed without building a tree.
+         * @throw XJsonError If `bytes` is not a valid document of `format`, or holds a byte string.
+         * @note Members keep their encoded order; the text is meant for `Parse()`, not as the canonical form.
+         */
+        std::string BinaryToText(const std::uint8_t* bytes, std::size_t size, JsonBinaryFormat format);
+
+    }  // namespace Details
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_DETAILS_JSONBINARYCODEC_HPP_
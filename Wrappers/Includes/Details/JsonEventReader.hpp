@@ -0,0 +1,24 @@
+#ifndef _INCLUDE_JSON_WRAPPER_DETAILS_JSONEVENTREADER_HPP_
+#define _INCLUDE_JSON_WRAPPER_DETAILS_JSONEVENTREADER_HPP_
+
+#include <string_view>
+
+namespace Wrappers
+{
+    class IJsonHandler;
+
+    namespace Details
+    {
+        /**
+         * @brief Parse a JSON text into events for `handler`, without building a tree.
+         * @throw XJsonError If `json` is not valid JSON, or whatever `handler` throws. `handler` may have received
+         *        part of the events then.
+         * @note Members keep their order in the text.
+         */
+        void ReadEvents(std::string_view json, IJsonHandler& handler);
+
+    }  // namespace Details
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_DETAILS_JSONEVENTREADER_HPP_
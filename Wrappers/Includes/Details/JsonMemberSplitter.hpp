@@ -0,0 +1,227 @@
+#ifndef _INCLUDE_JSON_WRAPPER_DETAILS_JSONMEMBERSPLITTER_HPP_
+#define _INCLUDE_JSON_WRAPPER_DETAILS_JSONMEMBERSPLITTER_HPP_
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        /**
+         * @class JsonMemberSplitter
+         * @brief Cuts a JSON text arriving in chunks into the top level members of its root object, for the
+         *        incremental parsers behind `Wrappers::JsonFeedParser`.
+         * @note Only the top level structure is checked. Strings and nesting are tracked to find where each member
+         *       ends; the values are left for the backend to parse.
+         * @note Bytes are kept from the start of the member being received only, so that memory is bounded by the
+         *       largest member plus a chunk rather than by the document. With `splitArrays`, a root array and an
+         *       array member still open when a chunk ends are cut into their elements as well, so that the bound is
+         *       the largest element. Any other root is kept whole.
+         */
+        class JsonMemberSplitter
+        {
+        public:
+            /**
+             * @brief What a `Member` adds to the document.
+             */
+            enum class Kind
+            {
+                /**
+                 * @brief A complete member, set as `key`.
+                 */
+                Member,
+
+                /**
+                 * @brief An element appended to the array member `key`, set to `[]` by an earlier `Member`; or to
+                 *        the root when `IsArray()`, with an empty key.
+                 */
+                Element
+            };
+
+            /**
+             * @brief A complete top level member or array element.
+             */
+            struct Member
+            {
+                /**
+                 * @brief The unescaped key.
+                 */
+                std::string_view key;
+
+                /**
+                 * @brief The value as JSON text, without surrounding whitespace.
+                 */
+                std::string_view value;
+
+                Kind kind{Kind::Member};
+            };
+
+            /**
+             * @param splitArrays Whether arrays are cut into `Kind::Element` pieces; the backend must append them.
+             */
+            explicit JsonMemberSplitter(bool splitArrays = false);
+
+            /**
+             * @brief Scan the next chunk of the text.
+             * @return The members and elements completed by `chunk`, in text order. Valid until the next call.
+             * @throw XJsonError If the top level structure is malformed, or an earlier call failed.
+             */
+            const std::vector<Member>& Feed(std::string_view chunk);
+
+            /**
+             * @brief Check that the text is complete.
+             * @return The whole text when the root is neither an object nor a split array; empty otherwise.
+             * @throw XJsonError If the text is blank or the root object or array is not closed.
+             */
+            std::string_view Finish();
+
+            /**
+             * @brief Whether the root is an object; @b false until its first character is received.
+             */
+            bool IsObject() const;
+
+            /**
+             * @brief Whether the root is an array cut into elements; @b false until its first character is received.
+             */
+            bool IsArray() const;
+
+        private:
+            enum class State
+            {
+                Root,
+                Text,
+                ObjectStart,
+                MemberStart,
+                Key,
+                Colon,
+                ValueStart,
+                Value,
+                Done,
+                Failed
+            };
+
+            /**
+             * @brief Mark the splitter as failed and throw `XJsonError` with `errorMessage`.
+             */
+            [[noreturn]] void Fail(const char* errorMessage);
+
+            /**
+             * @brief Record the member whose value ends at `end`; its bytes are released by the next `Feed()`.
+             */
+            void EndMember(std::size_t end);
+
+            /**
+             * @brief Record the element of the array value that ends at `end`, or check that the array closed there
+             *        is empty if `last` and no element precedes.
+             */
+            void EndElement(std::size_t end, bool last);
+
+            /**
+             * @brief Switch the array member being received to elements: report it as `[]`, then the elements
+             *        completed so far, and release their bytes.
+             */
+            void SplitMember();
+
+            /**
+             * @brief The unescaped key of the member being received; valid until the next `Feed()`.
+             */
+            std::string_view Key();
+
+            /**
+             * @brief The text of `[begin, end)` without surrounding whitespace.
+             */
+            std::string_view Trim(std::size_t begin, std::size_t end) const;
+
+            const bool _splitArrays;
+
+            State _state{State::Root};
+
+            /**
+             * @brief Text not dropped yet: from the start of the member being received, or the whole root.
+             */
+            std::string _buffer;
+
+            /**
+             * @brief Bytes of `_buffer` that are no longer needed, dropped by the next `Feed()`.
+             */
+            std::size_t _consumed{0};
+
+            /**
+             * @brief Next byte of `_buffer` to scan.
+             */
+            std::size_t _position{0};
+
+            std::size_t _keyBegin{0};
+
+            std::size_t _keyEnd{0};
+
+            std::size_t _valueBegin{0};
+
+            /**
+             * @brief Open arrays and objects inside the current value.
+             */
+            std::size_t _depth{0};
+
+            bool _inString{false};
+
+            /**
+             * @brief Whether the current value is an array, i.e. its elements are tracked.
+             */
+            bool _arrayValue{false};
+
+            /**
+             * @brief Whether the elements of the current array are reported as they complete.
+             */
+            bool _splitting{false};
+
+            /**
+             * @brief Whether the root is an array, split from its first byte.
+             */
+            bool _rootArray{false};
+
+            /**
+             * @brief Start of the element being received.
+             */
+            std::size_t _elementBegin{0};
+
+            std::size_t _elementCount{0};
+
+            /**
+             * @brief Elements of the array value completed while it is not split yet, as `[begin, end)` offsets.
+             */
+            std::vector<std::pair<std::size_t, std::size_t>> _elements;
+
+            /**
+             * @brief Key of the array member being split, kept across calls once its bytes are released.
+             */
+            std::string _splitKey;
+
+            /**
+             * @brief Key reported with the elements of the current call: a copy of `_splitKey` or the buffer's.
+             */
+            std::string_view _elementKey;
+
+            /**
+             * @brief Whether the key being received has escapes.
+             */
+            bool _keyEscaped{false};
+
+            std::vector<Member> _members;
+
+            /**
+             * @brief Keys with escapes, decoded, and the copy of `_splitKey`, for the members returned by the last
+             *        `Feed()`.
+             */
+            std::deque<std::string> _unescapedKeys;
+        };
+
+    }  // namespace Details
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_DETAILS_JSONMEMBERSPLITTER_HPP_
@@ -0,0 +1,135 @@
+#ifndef _INCLUDE_JSON_WRAPPER_DETAILS_JSONOUTPUT_HPP_
+#define _INCLUDE_JSON_WRAPPER_DETAILS_JSONOUTPUT_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace Wrappers
+{
+    class IJsonSink;
+
+    namespace Details
+    {
+        /**
+         * @class JsonOutput
+         * @brief Destination of the serializers: appends to a string, fills a fixed buffer or feeds a sink.
+         * @note `push_back()` and `append()` mirror the `std::string` members the serializers use, so that they can
+         *       write to either. Both only bump a pointer until the current window is full.
+         */
+        class JsonOutput
+        {
+        public:
+            /**
+             * @brief Append to `target`, reusing its capacity.
+             */
+            explicit JsonOutput(std::string& target);
+
+            /**
+             * @brief Write to `buffer`. Bytes past `capacity` are counted but dropped.
+             */
+            JsonOutput(char* buffer, std::size_t capacity);
+
+            /**
+             * @brief Hand the output to `sink` in chunks of `kChunkSize` bytes.
+             */
+            explicit JsonOutput(IJsonSink& sink);
+
+            /**
+             * @brief Trims a string target to what was written, even if serialization failed midway.
+             */
+            ~JsonOutput();
+
+            JsonOutput(const JsonOutput&) = delete;
+
+            JsonOutput& operator=(const JsonOutput&) = delete;
+
+            JsonOutput(JsonOutput&&) = delete;
+
+            JsonOutput& operator=(JsonOutput&&) = delete;
+
+            void push_back(char character)
+            {
+                if (_cursor == _end)
+                {
+                    Overflow(1);
+                }
+                *_cursor++ = character;
+            }
+
+            void append(std::string_view text)
+            {
+                if (text.size() > static_cast<std::size_t>(_end - _cursor))
+                {
+                    AppendSlow(text);
+                    return;
+                }
+
+                std::memcpy(_cursor, text.data(), text.size());
+                _cursor += text.size();
+            }
+
+            void append(std::size_t count, char character);
+
+            /**
+             * @brief Flush the last chunk to a sink target and trim a string target.
+             * @return Number of bytes produced, including those a fixed buffer could not hold.
+             */
+            std::size_t Finish();
+
+            /**
+             * @brief Size of the chunks handed to a sink.
+             */
+            static constexpr std::size_t kChunkSize = 4096;
+
+        private:
+            enum class Target
+            {
+                String,
+                Buffer,
+                Sink
+            };
+
+            /**
+             * @brief Make room for at least `size` more bytes, or for at least one if the target is chunked.
+             */
+            void Overflow(std::size_t size);
+
+            void AppendSlow(std::string_view text);
+
+            Target _target;
+
+            /**
+             * @brief The string target and its size before the first write.
+             */
+            std::string* _string{nullptr};
+            std::size_t _initialSize{0};
+
+            IJsonSink* _sink{nullptr};
+
+            /**
+             * @brief The window being filled: `[_begin, _end)`, written up to `_cursor`.
+             */
+            char* _begin{nullptr};
+            char* _cursor{nullptr};
+            char* _end{nullptr};
+
+            /**
+             * @brief Bytes produced before `_begin`, for chunked targets.
+             */
+            std::size_t _flushed{0};
+
+            /**
+             * @brief Window for a sink target, and overflow scratch for a buffer target. Left uninitialized: only
+             *        written bytes are ever read.
+             */
+            std::array<char, kChunkSize> _chunk;
+        };
+
+    }  // namespace Details
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_DETAILS_JSONOUTPUT_HPP_
@@ -0,0 +1,69 @@
+#ifndef _INCLUDE_JSON_WRAPPER_DETAILS_JSONTEXTFORMAT_HPP_
+#define _INCLUDE_JSON_WRAPPER_DETAILS_JSONTEXTFORMAT_HPP_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        class JsonOutput;
+
+        /**
+         * @brief Append a quoted and escaped JSON string.
+         * @param out The buffer to append to.
+         * @param value The raw (unescaped) string value.
+         * @throw XJsonError If the value is not valid UTF-8.
+         * @note Escaping matches `nlohmann::json::dump()` so that every backend emits identical text.
+         */
+        void AppendString(std::string& out, std::string_view value);
+
+        /**
+         * @brief Same as above, written to a `JsonOutput`.
+         */
+        void AppendString(JsonOutput& out, std::string_view value);
+
+        /**
+         * @brief Append a signed integer.
+         * @param out The buffer to append to.
+         * @param value The value to append.
+         */
+        void AppendInt(std::string& out, int64_t value);
+
+        /**
+         * @brief Same as above, written to a `JsonOutput`.
+         */
+        void AppendInt(JsonOutput& out, int64_t value);
+
+        /**
+         * @brief Append an unsigned integer.
+         * @param out The buffer to append to.
+         * @param value The value to append.
+         */
+        void AppendUnsigned(std::string& out, uint64_t value);
+
+        /**
+         * @brief Same as above, written to a `JsonOutput`.
+         */
+        void AppendUnsigned(JsonOutput& out, uint64_t value);
+
+        /**
+         * @brief Append a double using the shortest representation that round-trips.
+         * @param out The buffer to append to.
+         * @param value The value to append.
+         * @note Layout matches `nlohmann::json::dump()`, e.g. `3.14`, `100.0`, `1e-05`. Non-finite values become `null`.
+         */
+        void AppendDouble(std::string& out, double value);
+
+        /**
+         * @brief Same as above, written to a `JsonOutput`.
+         */
+        void AppendDouble(JsonOutput& out, double value);
+
+    }  // namespace Details
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_DETAILS_JSONTEXTFORMAT_HPP_
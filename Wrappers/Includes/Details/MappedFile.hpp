@@ -0,0 +1,90 @@
+#ifndef _INCLUDE_JSON_WRAPPER_DETAILS_MAPPEDFILE_HPP_
+#define _INCLUDE_JSON_WRAPPER_DETAILS_MAPPEDFILE_HPP_
+
+#include <cstddef>
+#include <string>
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        /**
+         * @class MappedFile
+         * @brief Read-only file contents followed by zeroed padding, memory-mapped where the platform allows it.
+         * @note The mapping is private and writable: writes (e.g. in situ parsing) copy the touched pages only and
+         *       never reach the file. Pages are loaded on first access, so untouched parts of a file cost nothing.
+         * @note Platforms without `mmap()` read the file into an owned buffer instead.
+         */
+        class MappedFile
+        {
+        public:
+            /**
+             * @brief An empty mapping.
+             */
+            MappedFile() = default;
+
+            /**
+             * @brief Map a whole file.
+             * @param filePath The file to map.
+             * @param padding Zeroed bytes readable (and writable) after the end of the contents.
+             * @throw XJsonError If the file cannot be opened or mapped.
+             */
+            MappedFile(const std::string& filePath, std::size_t padding);
+
+            ~MappedFile();
+
+            MappedFile(const MappedFile&) = delete;
+
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            MappedFile(MappedFile&& other) noexcept;
+
+            MappedFile& operator=(MappedFile&& other) noexcept;
+
+            /**
+             * @brief First byte of the contents, `nullptr` for an empty mapping.
+             */
+            char* Data() const;
+
+            /**
+             * @brief Size of the contents, without padding.
+             */
+            std::size_t Size() const;
+
+            /**
+             * @brief Bytes readable from `Data()`: the contents plus at least the requested padding.
+             */
+            std::size_t Capacity() const;
+
+        private:
+            /**
+             * @brief Unmap and become empty.
+             */
+            void Release();
+
+            /**
+             * @brief Start of the mapped region.
+             */
+            char* _data{nullptr};
+
+            /**
+             * @brief Size of the file contents.
+             */
+            std::size_t _size{0};
+
+            /**
+             * @brief Size of the mapped region (a multiple of the page size) or of the fallback buffer.
+             */
+            std::size_t _mappedSize{0};
+
+            /**
+             * @brief Fallback storage where `mmap()` is not available.
+             */
+            std::string _buffer;
+        };
+
+    }  // namespace Details
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_DETAILS_MAPPEDFILE_HPP_
@@ -0,0 +1,123 @@
+#ifndef _INCLUDE_JSON_WRAPPER_DETAILS_MEMORYRESOURCE_HPP_
+#define _INCLUDE_JSON_WRAPPER_DETAILS_MEMORYRESOURCE_HPP_
+
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        /**
+         * @brief The resource `ResourceAllocator` allocates from on the calling thread.
+         * @return The resource bound by the innermost `ResourceScope`, `std::pmr::get_default_resource()` otherwise.
+         */
+        std::pmr::memory_resource* CurrentResource();
+
+        /**
+         * @class ResourceScope
+         * @brief Binds a memory resource to the calling thread for its lifetime, for allocators that cannot carry
+         *        one (nlohmann default-constructs its allocators on every allocation).
+         */
+        class ResourceScope
+        {
+        public:
+            /**
+             * @param resource The resource to bind; `nullptr` binds the default resource.
+             */
+            explicit ResourceScope(std::pmr::memory_resource* resource);
+
+            ~ResourceScope();
+
+            ResourceScope(const ResourceScope&) = delete;
+
+            ResourceScope& operator=(const ResourceScope&) = delete;
+
+            ResourceScope(ResourceScope&&) = delete;
+
+            ResourceScope& operator=(ResourceScope&&) = delete;
+
+        private:
+            std::pmr::memory_resource* _previous;
+        };
+
+        /**
+         * @class NoResourceScope
+         * @brief Stands in for `ResourceScope` where the allocator doesn't draw from `CurrentResource()`.
+         */
+        class NoResourceScope
+        {
+        public:
+            explicit NoResourceScope(std::pmr::memory_resource* /*resource*/) noexcept
+            {
+            }
+        };
+
+        /**
+         * @brief Allocate `size` bytes from `resource`, behind a tag naming the resource.
+         * @param alignment Of the returned bytes; at least that of any scalar type.
+         * @note The tag lets `DeallocateTagged()` return the block to its resource without being told which one it
+         *       is, whichever thread or scope frees it.
+         * @throw std::bad_alloc If the resource is exhausted.
+         */
+        void* AllocateTagged(std::size_t size,
+                             std::pmr::memory_resource* resource,
+                             std::size_t alignment = alignof(std::max_align_t));
+
+        /**
+         * @brief Release a block of `AllocateTagged()` to the resource it came from. Ignores `nullptr`.
+         * @param alignment The one the block was allocated with.
+         */
+        void DeallocateTagged(void* memory, std::size_t alignment = alignof(std::max_align_t)) noexcept;
+
+        /**
+         * @class ResourceAllocator
+         * @brief Stateless allocator drawing from `CurrentResource()`. Blocks are tagged, so all instances are equal
+         *        and containers may move or swap nodes coming from different resources.
+         * @tparam TValue The allocated type; at most `alignof(std::max_align_t)` aligned.
+         */
+        template<typename TValue>
+        class ResourceAllocator
+        {
+        public:
+            using value_type = TValue;
+            using is_always_equal = std::true_type;
+            using propagate_on_container_move_assignment = std::true_type;
+
+            ResourceAllocator() noexcept = default;
+
+            template<typename TOther>
+            ResourceAllocator(const ResourceAllocator<TOther>& /*other*/) noexcept
+            {
+            }
+
+            TValue* allocate(std::size_t count)
+            {
+                static_assert(alignof(TValue) <= alignof(std::max_align_t), "over-aligned types are not supported");
+                return static_cast<TValue*>(AllocateTagged(count * sizeof(TValue), CurrentResource()));
+            }
+
+            void deallocate(TValue* values, std::size_t /*count*/) noexcept
+            {
+                DeallocateTagged(values);
+            }
+        };
+
+        template<typename TValue, typename TOther>
+        bool operator==(const ResourceAllocator<TValue>& /*lhs*/, const ResourceAllocator<TOther>& /*rhs*/) noexcept
+        {
+            return true;
+        }
+
+        template<typename TValue, typename TOther>
+        bool operator!=(const ResourceAllocator<TValue>& /*lhs*/, const ResourceAllocator<TOther>& /*rhs*/) noexcept
+        {
+            return false;
+        }
+
+    }  // namespace Details
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_DETAILS_MEMORYRESOURCE_HPP_
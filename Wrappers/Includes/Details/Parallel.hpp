@@ -0,0 +1,28 @@
+#ifndef _INCLUDE_JSON_WRAPPER_DETAILS_PARALLEL_HPP_
+#define _INCLUDE_JSON_WRAPPER_DETAILS_PARALLEL_HPP_
+
+#include <cstddef>
+#include <functional>
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        /**
+         * @brief Run `task(0)` to `task(count - 1)` on up to `threadCount` threads, the calling one included.
+         * @param threadCount 0 for one per hardware thread.
+         * @throw Whatever a task throws; the exception of the lowest failing index seen is rethrown once every thread
+         *        stopped, and the tasks not started yet are skipped.
+         * @note Threads take the next index from a shared counter until none is left, so a thread that drew short
+         *       tasks goes on with the next one instead of idling. If no more threads can be started, the ones
+         *       running take over their share.
+         * @note The helper threads are kept for the next call. A call made while another one is running, from a task
+         *       or from another thread, starts and joins helpers of its own.
+         */
+        void RunParallel(std::size_t count, std::size_t threadCount, const std::function<void(std::size_t)>& task);
+
+    }  // namespace Details
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_DETAILS_PARALLEL_HPP_
@@ -0,0 +1,222 @@
+#ifndef _INCLUDE_JSON_WRAPPER_DETAILS_SORTEDVECTORMAP_HPP_
+#define _INCLUDE_JSON_WRAPPER_DETAILS_SORTEDVECTORMAP_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        /**
+         * @class SortedVectorMap
+         * @brief Object type of `nlohmann::basic_json` holding the members in one vector sorted by key: as compact as
+         *        `nlohmann::ordered_map`, found by a binary search and in the order of `std::map`.
+         * @tparam TCompare Orders the keys. nlohmann passes `std::less<>`, so that lookups take any key-like type
+         *         without building a key.
+         * @tparam TAllocator Allocator of `std::pair<const TKey, TValue>`, as nlohmann passes it; rebound to the pair
+         *         the vector holds.
+         * @note Members are `std::pair<TKey, TValue>`, without a const key, so that inserting and erasing in the middle
+         *       move them rather than copy. Keys must not be changed through an iterator.
+         * @note Inserting and erasing move the members after the position and invalidate iterators and references,
+         *       as with `nlohmann::ordered_map`.
+         */
+        template<typename TKey,
+                 typename TValue,
+                 typename TCompare = std::less<>,
+                 typename TAllocator = std::allocator<std::pair<const TKey, TValue>>>
+        class SortedVectorMap
+            : public std::vector<
+                  std::pair<TKey, TValue>,
+                  typename std::allocator_traits<TAllocator>::template rebind_alloc<std::pair<TKey, TValue>>>
+        {
+        public:
+            using Container = std::vector<
+                std::pair<TKey, TValue>,
+                typename std::allocator_traits<TAllocator>::template rebind_alloc<std::pair<TKey, TValue>>>;
+            using key_type = TKey;
+            using mapped_type = TValue;
+            using key_compare = TCompare;
+            using value_type = typename Container::value_type;
+            using allocator_type = typename Container::allocator_type;
+            using size_type = typename Container::size_type;
+            using iterator = typename Container::iterator;
+            using const_iterator = typename Container::const_iterator;
+
+            SortedVectorMap() = default;
+
+            explicit SortedVectorMap(const allocator_type& allocator) : Container(allocator)
+            {
+            }
+
+            /**
+             * @brief The members of `[first, last)`; of several equal keys the first is kept, as by `std::map`.
+             */
+            template<typename TInputIterator>
+            SortedVectorMap(TInputIterator first, TInputIterator last, const allocator_type& allocator = {})
+                : Container(first, last, allocator)
+            {
+                std::stable_sort(this->begin(), this->end(), [](const value_type& lhs, const value_type& rhs) {
+                    return TCompare{}(lhs.first, rhs.first);
+                });
+                const auto duplicates =
+                    std::unique(this->begin(), this->end(), [](const value_type& lhs, const value_type& rhs) {
+                        return !TCompare{}(lhs.first, rhs.first);
+                    });
+                Container::erase(duplicates, this->end());
+            }
+
+            template<typename TKeyLike>
+            iterator find(const TKeyLike& key)
+            {
+                return Find(this->begin(), this->end(), key);
+            }
+
+            template<typename TKeyLike>
+            const_iterator find(const TKeyLike& key) const
+            {
+                return Find(this->begin(), this->end(), key);
+            }
+
+            template<typename TKeyLike>
+            size_type count(const TKeyLike& key) const
+            {
+                return (find(key) != this->end()) ? 1 : 0;
+            }
+
+            /**
+             * @brief Insert a member built from `key` and `args` unless `key` is there already.
+             * @return The member of `key`, and whether it was inserted.
+             */
+            template<typename TKeyLike, typename... TArgs>
+            std::pair<iterator, bool> emplace(TKeyLike&& key, TArgs&&... args)
+            {
+                const iterator member = LowerBound(this->begin(), this->end(), key);
+                if (member != this->end() && !TCompare{}(key, member->first))
+                {
+                    return {member, false};
+                }
+
+                return {Container::emplace(member,
+                                           std::piecewise_construct,
+                                           std::forward_as_tuple(std::forward<TKeyLike>(key)),
+                                           std::forward_as_tuple(std::forward<TArgs>(args)...)),
+                        true};
+            }
+
+            std::pair<iterator, bool> insert(const value_type& member)
+            {
+                return emplace(member.first, member.second);
+            }
+
+            std::pair<iterator, bool> insert(value_type&& member)
+            {
+                return emplace(std::move(member.first), std::move(member.second));
+            }
+
+            template<typename TInputIterator>
+            void insert(TInputIterator first, TInputIterator last)
+            {
+                for (; first != last; ++first)
+                {
+                    insert(*first);
+                }
+            }
+
+            template<typename TKeyLike>
+            TValue& operator[](TKeyLike&& key)
+            {
+                return emplace(std::forward<TKeyLike>(key)).first->second;
+            }
+
+            iterator erase(iterator position)
+            {
+                return Container::erase(position);
+            }
+
+            iterator erase(const_iterator position)
+            {
+                return Container::erase(position);
+            }
+
+            iterator erase(const_iterator first, const_iterator last)
+            {
+                return Container::erase(first, last);
+            }
+
+            template<typename TKeyLike>
+            size_type erase(const TKeyLike& key)
+            {
+                const iterator member = find(key);
+                if (member == this->end())
+                {
+                    return 0;
+                }
+
+                Container::erase(member);
+                return 1;
+            }
+
+        private:
+            /**
+             * @brief The first member of `[first, last)` whose key is not less than `key`.
+             */
+            template<typename TIterator, typename TKeyLike>
+            static TIterator LowerBound(TIterator first, TIterator last, const TKeyLike& key)
+            {
+                return std::lower_bound(first, last, key, [](const value_type& member, const TKeyLike& searched) {
+                    return TCompare{}(member.first, searched);
+                });
+            }
+
+            /**
+             * @brief The member of `[first, last)` whose key is `key`, `last` if there is none.
+             * @note Halves the range down to `kScanSize` members, then scans those for an equal key: cheaper than
+             *       ordering comparisons to the end, as most keys differ in size.
+             */
+            template<typename TIterator, typename TKeyLike>
+            static TIterator Find(TIterator first, TIterator last, const TKeyLike& key)
+            {
+                auto count = last - first;
+                while (count > kScanSize)
+                {
+                    const auto half = count / 2;
+                    if (TCompare{}(first[half].first, key))
+                    {
+                        first += half + 1;
+                        count -= half + 1;
+                    }
+                    else
+                    {
+                        count = half;
+                    }
+                }
+
+                // the key is in `[first, first + count]`, the last one included
+                const TIterator end = (first + count == last) ? last : first + count + 1;
+                for (; first != end; ++first)
+                {
+                    if (first->first == key)
+                    {
+                        return first;
+                    }
+                }
+                return last;
+            }
+
+            /**
+             * @brief Members left to `Find()`'s linear scan.
+             */
+            static constexpr std::ptrdiff_t kScanSize = 8;
+        };
+
+    }  // namespace Details
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_DETAILS_SORTEDVECTORMAP_HPP_
@@ -1,63 +1,445 @@
 #ifndef _INCLUDE_JSON_WRAPPER_INCLUDES_NLOHMANNJSONWRAPPER_HPP_
 #define _INCLUDE_JSON_WRAPPER_INCLUDES_NLOHMANNJSONWRAPPER_HPP_
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
 #include <nlohmann/json.hpp>
 
+#include "Details/MemoryResource.hpp"
+#include "Details/SortedVectorMap.hpp"
 #include "Interfaces/IJsonWrapper.hpp"
 
 namespace Wrappers
 {
     /**
-     * @class NlohmannJsonWrapper
+     * @class BasicNlohmannJsonWrapper
      * @brief Implementation of `Wrappers::IJsonWrapper` interface.
+     * @tparam TObject The map holding the members of objects: `std::map` for `Wrappers::NlohmannJsonWrapper`,
+     *         `Details::SortedVectorMap` for `Wrappers::NlohmannFlatJsonWrapper`.
+     * @tparam TAllocator The allocator of nodes and strings: `std::allocator`, which makes the document a plain
+     *         `nlohmann::json`, or `Details::ResourceAllocator` for `Wrappers::NlohmannPmrJsonWrapper`.
+     * @note Nested wrappers are allocated from the `std::pmr::memory_resource` given at construction, and with
+     *       `Details::ResourceAllocator` nodes and strings as well. With a `std::pmr::monotonic_buffer_resource` a
+     *       whole request then lives in one region, released at once by `release()` after the wrappers are gone.
+     *
+     * @code
+     * std::pmr::monotonic_buffer_resource arena{64 * 1024};
+     * {
+     *     std::unique_ptr<Wrappers::IJsonWrapper> request{new (&arena) Wrappers::NlohmannPmrJsonWrapper{&arena}};
+     *     request->Parse(body);
+     *     Handle(request->GetObject("params"));
+     * }
+     * arena.release();
+     * @endcode
+     *
+     * @note `ParseLazy()` of an object only indexes its members, keeping slices of the caller's text; each member is
+     *       decoded the first time it is read by key. Reading the whole document (`View()`, serialization, path
+     *       access) decodes all of it, and so does the first setter. Decoding is serialized, so that the document can
+     *       be read from several threads at once as after `Parse()`.
      */
-    class NlohmannJsonWrapper : public IJsonWrapper
+    template<template<typename, typename, typename...> class TObject,
+             template<typename> class TAllocator = std::allocator>
+    class BasicNlohmannJsonWrapper : public IJsonWrapper
     {
     public:
-        NlohmannJsonWrapper() = default;
+        /**
+         * @brief Strings of the document.
+         */
+        using String = std::basic_string<char, std::char_traits<char>, TAllocator<char>>;
+
+        /**
+         * @brief `nlohmann::json` with the maps and allocator of the wrapper.
+         */
+        using Json =
+            nlohmann::basic_json<TObject, std::vector, String, bool, std::int64_t, std::uint64_t, double, TAllocator>;
+
+        BasicNlohmannJsonWrapper() = default;
+
+        /**
+         * @param resource Supplies the nested wrappers, and with `Details::ResourceAllocator` every node and string;
+         *        `nullptr` for the default resource. Must outlive the wrapper and the wrappers created from it.
+         */
+        explicit BasicNlohmannJsonWrapper(std::pmr::memory_resource* resource);
+
+        /**
+         * @note Out of line, so that the destructors of the named backends call it rather than inline the whole tree.
+         */
+        ~BasicNlohmannJsonWrapper() override;
+
+        /**
+         * @brief Copy the document, decoded in full first if it is lazy; nested wrappers come from the same resource.
+         * @throw XJsonError If a value of a lazy document is malformed.
+         */
+        BasicNlohmannJsonWrapper(const BasicNlohmannJsonWrapper& other);
+
+        /**
+         * @brief Take over the document, lazy or not, leaving `other` null.
+         */
+        BasicNlohmannJsonWrapper(BasicNlohmannJsonWrapper&& other) noexcept;
+
+        /**
+         * @brief Copy the document, decoded in full first if it is lazy; this wrapper keeps its own resource.
+         * @throw XJsonError If a value of a lazy document is malformed.
+         */
+        BasicNlohmannJsonWrapper& operator=(const BasicNlohmannJsonWrapper& other);
+
+        /**
+         * @brief Take over the document, lazy or not, leaving `other` null; this wrapper keeps its own resource.
+         */
+        BasicNlohmannJsonWrapper& operator=(BasicNlohmannJsonWrapper&& other) noexcept;
+
+        // non-virtual overloads of `IJsonWrapper`, hidden otherwise by the overrides below
+        using IJsonWrapper::GetBool;
+        using IJsonWrapper::GetDouble;
+        using IJsonWrapper::GetInt;
+        using IJsonWrapper::GetObjectView;
+        using IJsonWrapper::GetString;
+        using IJsonWrapper::GetStringView;
+        using IJsonWrapper::GetUnsigned;
+        using IJsonWrapper::HasKey;
+        using IJsonWrapper::IsNull;
+        using IJsonWrapper::Parse;
+        using IJsonWrapper::SetBool;
+        using IJsonWrapper::SetDouble;
+        using IJsonWrapper::SetInt;
+        using IJsonWrapper::SetNull;
+        using IJsonWrapper::SetObject;
+        using IJsonWrapper::SetString;
+        using IJsonWrapper::SetUnsigned;
+
+        void SetInt(std::string_view key, int64_t value) override;
 
-        ~NlohmannJsonWrapper() override = default;
+        void SetUnsigned(std::string_view key, uint64_t value) override;
 
-        void SetInt(const std::string& key, int64_t value) override;
+        void SetDouble(std::string_view key, double value) override;
 
-        void SetUnsigned(const std::string& key, uint64_t value) override;
+        void SetBool(std::string_view key, bool value) override;
 
-        void SetDouble(const std::string& key, double value) override;
+        void SetString(std::string_view key, std::string_view value) override;
 
-        void SetBool(const std::string& key, bool value) override;
+        void SetObject(std::string_view key, std::unique_ptr<IJsonWrapper> jsonObject) override;
 
-        void SetString(const std::string& key, const std::string& value) override;
+        /**
+         * @brief Same as above without the type check, for callers that already hold this backend.
+         * @note A template, so that it is also picked over the overload above for the named backends derived from
+         *       this class.
+         */
+        template<typename TWrapper, typename = std::enable_if_t<std::is_base_of_v<BasicNlohmannJsonWrapper, TWrapper>>>
+        void SetObject(std::string_view key, std::unique_ptr<TWrapper> jsonObject)
+        {
+            SetNlohmannObject(key, std::move(jsonObject));
+        }
 
-        void SetObject(const std::string& key, std::unique_ptr<IJsonWrapper> jsonObject) override;
+        void SetNull(std::string_view key) override;
 
-        void SetNull(const std::string& key) override;
+        void SetIntArray(std::string_view key, const int64_t* values, std::size_t count) override;
 
-        int64_t GetInt(const std::string& key) const override;
+        void SetUnsignedArray(std::string_view key, const uint64_t* values, std::size_t count) override;
 
-        uint64_t GetUnsigned(const std::string& key) const override;
+        void SetDoubleArray(std::string_view key, const double* values, std::size_t count) override;
 
-        double GetDouble(const std::string& key) const override;
+        void SetStringArray(std::string_view key, const std::string_view* values, std::size_t count) override;
 
-        bool GetBool(const std::string& key) const override;
+        int64_t GetInt(std::string_view key) const override;
 
-        std::string GetString(const std::string& key) const override;
+        uint64_t GetUnsigned(std::string_view key) const override;
 
-        std::unique_ptr<IJsonWrapper> GetObject(const std::string& key) const override;
+        double GetDouble(std::string_view key) const override;
 
-        bool IsNull(const std::string& key) const override;
+        bool GetBool(std::string_view key) const override;
 
-        bool HasKey(const std::string& key) const override;
+        std::string GetString(std::string_view key) const override;
+
+        std::string_view GetStringView(std::string_view key) const override;
+
+        std::unique_ptr<IJsonWrapper> GetObject(std::string_view key) const override;
+
+        bool IsNull(std::string_view key) const override;
+
+        bool HasKey(std::string_view key) const override;
 
         std::unique_ptr<IJsonWrapper> GetEmptyObject() const override;
 
-        void Parse(const std::string& inputJson) override;
+        /**
+         * @return @b true, lazy mode included, unless the wrapper draws from a memory resource given at construction:
+         *         `GetObject()` allocates from it, and it need not be thread-safe.
+         */
+        bool AllowsConcurrentReads() const override;
+
+        void Parse(std::string_view inputJson) override;
+
+        void ParseLazy(std::string_view inputJson) override;
 
         std::string ToString() const override;
 
+        /**
+         * @note Encoded straight from the tree with nlohmann's codecs, without the text form.
+         */
+        std::vector<std::uint8_t> ToBinary(JsonBinaryFormat format) const override;
+
+        void ParseBinary(JsonBinaryFormat format, const std::uint8_t* bytes, std::size_t size) override;
+
         void someAPI() const {}
 
+    protected:
+        JsonNode RootNode() const override;
+
+        JsonNode MemberNode(JsonNode object, std::string_view key) const override;
+
+        int64_t NodeToInt(JsonNode node) const override;
+
+        uint64_t NodeToUnsigned(JsonNode node) const override;
+
+        double NodeToDouble(JsonNode node) const override;
+
+        bool NodeToBool(JsonNode node) const override;
+
+        std::string_view NodeToStringView(JsonNode node) const override;
+
+        JsonErrorCode NodeTryToInt(JsonNode node, int64_t& value) const override;
+
+        JsonErrorCode NodeTryToUnsigned(JsonNode node, uint64_t& value) const override;
+
+        JsonErrorCode NodeTryToDouble(JsonNode node, double& value) const override;
+
+        JsonErrorCode NodeTryToBool(JsonNode node, bool& value) const override;
+
+        JsonErrorCode NodeTryToStringView(JsonNode node, std::string_view& value) const override;
+
+        bool NodeIsNull(JsonNode node) const override;
+
+        bool NodeIsObject(JsonNode node) const override;
+
+        bool NodeIsArray(JsonNode node) const override;
+
+        std::size_t NodeArraySize(JsonNode node) const override;
+
+        JsonNode ElementNode(JsonNode array, std::size_t index) const override;
+
+        void NodeForEachMember(JsonNode object, IJsonMemberVisitor& visitor) const override;
+
+        std::size_t NodeToIntArray(JsonNode node, int64_t* values, std::size_t capacity) const override;
+
+        std::size_t NodeToUnsignedArray(JsonNode node, uint64_t* values, std::size_t capacity) const override;
+
+        std::size_t NodeToDoubleArray(JsonNode node, double* values, std::size_t capacity) const override;
+
+        std::unique_ptr<IJsonWrapper> NodeToObject(JsonNode node) const override;
+
+        std::string NodeToString(JsonNode node) const override;
+
+        void NodeSerialize(JsonNode node, Details::JsonOutput& output) const override;
+
+        void NodeEmit(JsonNode node, IJsonHandler& handler) const override;
+
+        std::unique_ptr<IJsonWrapper> DetachObject(std::string_view key) override;
+
+        /**
+         * @note Members and array elements are parsed straight into the tree as they complete, instead of into
+         *       wrappers of their own.
+         */
+        std::unique_ptr<IJsonFeedCursor> OpenFeed() override;
+
+        /**
+         * @brief Create the empty wrapper of a nested object, from and allocating from `resource`.
+         * @note The named backends override it, so that their nested objects have their type.
+         */
+        virtual std::unique_ptr<BasicNlohmannJsonWrapper> MakeEmptyNested(std::pmr::memory_resource* resource) const;
+
     private:
-        nlohmann::json _json;
+        class FeedCursor;
+
+        /**
+         * @brief A member of a lazily parsed object.
+         */
+        struct LazyMember
+        {
+            /**
+             * @brief The key, a slice of the input of `ParseLazy()`.
+             */
+            std::string_view key;
+
+            /**
+             * @brief The value text, a slice of the input of `ParseLazy()`.
+             */
+            std::string_view value;
+        };
+
+        /**
+         * @brief The value of the `LazyMember` at the same index, once decoded.
+         */
+        struct LazyValue
+        {
+            /**
+             * @brief Set, under `_lazyMutex`, once `json` holds the value.
+             */
+            std::atomic<bool> decoded{false};
+
+            Json json;
+        };
+
+        using LazyMembers = std::vector<LazyMember, TAllocator<LazyMember>>;
+
+        using LazyValues = std::vector<LazyValue, TAllocator<LazyValue>>;
+
+        /**
+         * @brief Binds `_resource` to the thread while the document allocates, for `Details::ResourceAllocator`; does
+         *        nothing for other allocators.
+         */
+        using Scope = std::conditional_t<std::is_same_v<TAllocator<char>, Details::ResourceAllocator<char>>,
+                                         Details::ResourceScope,
+                                         Details::NoResourceScope>;
+
+        /**
+         * @brief Steal the tree of `jsonObject` into the member `key`.
+         */
+        void SetNlohmannObject(std::string_view key, std::unique_ptr<BasicNlohmannJsonWrapper> jsonObject);
+
+        /**
+         * @brief The member `key` of the root, decoded first in lazy mode.
+         * @throw nlohmann::json::out_of_range If there is no such member.
+         * @throw XJsonError If the value is malformed.
+         */
+        const Json& RootMember(std::string_view key) const;
+
+        /**
+         * @brief The pending member `key`, decoded by the first reader; the last one wins, as in `Parse()`.
+         * @return `nullptr` if there is no such member.
+         * @throw XJsonError If the value is malformed.
+         */
+        const Json* DecodeMember(std::string_view key) const;
+
+        /**
+         * @brief Decode the whole lazily parsed object into `_json`, once.
+         * @throw XJsonError If a value is malformed.
+         */
+        void DecodeAll() const;
+
+        /**
+         * @brief `_json` after `DecodeAll()`, for copies.
+         */
+        const Json& DecodedJson() const;
+
+        /**
+         * @brief Take over the pending members of `other`, which is left out of lazy mode.
+         */
+        void TakeLazyMembers(BasicNlohmannJsonWrapper& other) noexcept;
+
+        /**
+         * @brief Decode the whole document and drop the pending members, before it is modified.
+         * @throw XJsonError If a value is malformed.
+         */
+        void LeaveLazyMode();
+
+        /**
+         * @brief Drop the pending members, whether decoded or not.
+         */
+        void ForgetLazyMembers();
+
+        /**
+         * @brief Whether keys are still looked up among the pending members rather than in `_json`.
+         */
+        bool IsLazy() const;
+
+        /**
+         * @brief Whether `node` is the root of a document that is still lazy.
+         */
+        bool IsLazyRoot(JsonNode node) const;
+
+        /**
+         * @brief The resource allocations are drawn from, `nullptr` for the default one.
+         */
+        std::pmr::memory_resource* _resource{nullptr};
+
+        /**
+         * @brief The document; in lazy mode an empty object until `DecodeAll()` fills it in.
+         */
+        mutable Json _json;
+
+        /**
+         * @brief Members of the input of `ParseLazy()` in document order. Empty outside lazy mode.
+         */
+        LazyMembers _lazyMembers;
+
+        /**
+         * @brief Decoded values of `_lazyMembers`, filled in by const getters.
+         */
+        mutable LazyValues _lazyValues;
+
+        /**
+         * @brief Serializes decoding between threads reading a lazy document.
+         */
+        mutable std::mutex _lazyMutex;
+
+        /**
+         * @brief Set, under `_lazyMutex`, once `DecodeAll()` filled in `_json`.
+         */
+        mutable std::atomic<bool> _lazyDecoded{false};
+    };
+
+    extern template class BasicNlohmannJsonWrapper<std::map>;
+
+    extern template class BasicNlohmannJsonWrapper<Details::SortedVectorMap>;
+
+    extern template class BasicNlohmannJsonWrapper<std::map, Details::ResourceAllocator>;
+
+    /**
+     * @class NlohmannJsonWrapper
+     * @brief The nlohmann backend with objects in a `std::map`: members sorted by key, one heap node each.
+     * @note The named backends are classes rather than aliases of the template, so that they can be forward-declared.
+     */
+    class NlohmannJsonWrapper : public BasicNlohmannJsonWrapper<std::map>
+    {
+    public:
+        using BasicNlohmannJsonWrapper::BasicNlohmannJsonWrapper;
+
+    protected:
+        std::unique_ptr<BasicNlohmannJsonWrapper> MakeEmptyNested(std::pmr::memory_resource* resource) const override;
+    };
+
+    /**
+     * @class NlohmannFlatJsonWrapper
+     * @brief The nlohmann backend with objects in a `Details::SortedVectorMap`: members sorted by key in one
+     *        contiguous vector, found by a binary search.
+     * @note Holds about a third less memory than the map, with one allocation per object rather than per member.
+     *       Lookups are as fast as with the map or faster. Adding a member moves those after it, so parsing objects
+     *       whose keys are out of order costs a little more.
+     */
+    class NlohmannFlatJsonWrapper : public BasicNlohmannJsonWrapper<Details::SortedVectorMap>
+    {
+    public:
+        using BasicNlohmannJsonWrapper::BasicNlohmannJsonWrapper;
+
+    protected:
+        std::unique_ptr<BasicNlohmannJsonWrapper> MakeEmptyNested(std::pmr::memory_resource* resource) const override;
+    };
+
+    /**
+     * @class NlohmannPmrJsonWrapper
+     * @brief The nlohmann backend with every node and string allocated from the `std::pmr::memory_resource` given at
+     *        construction, e.g. a request arena.
+     * @note nlohmann default-constructs its allocator for every node, so the allocator cannot carry the resource:
+     *       the wrapper binds it to the thread around each call that allocates, and every block is tagged with the
+     *       resource it came from, so that it is released there whichever wrapper or thread frees it. Both cost a
+     *       little on every allocation, which the other nlohmann backends don't pay.
+     */
+    class NlohmannPmrJsonWrapper : public BasicNlohmannJsonWrapper<std::map, Details::ResourceAllocator>
+    {
+    public:
+        using BasicNlohmannJsonWrapper::BasicNlohmannJsonWrapper;
+
+    protected:
+        std::unique_ptr<BasicNlohmannJsonWrapper> MakeEmptyNested(std::pmr::memory_resource* resource) const override;
     };
 
 }  // namespace Wrappers
@@ -0,0 +1,479 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INCLUDES_SIMDJSONWRAPPER_HPP_
+#define _INCLUDE_JSON_WRAPPER_INCLUDES_SIMDJSONWRAPPER_HPP_
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Details/MappedFile.hpp"
+#include "Interfaces/IJsonWrapper.hpp"
+
+namespace Wrappers
+{
+    /**
+     * @class SimdJsonWrapper
+     * @brief Implementation of `Wrappers::IJsonWrapper` interface on top of simdjson's On-Demand API.
+     * @note The document is kept as text in a reusable padded buffer and values are decoded only when read,
+     *       which makes it a good fit for parse-heavy, read-few-keys workloads.
+     * @note `Parse()` runs stage 1, which validates UTF-8 and strings, then checks the structure of the document and
+     *       the spelling of every number and atom without decoding any value. `ParseLazy()` skips the scalars, so
+     *       that a malformed number or atom is reported by the getter that reads it.
+     * @note Setters edit the document text in place without validating it again: a new member is appended before
+     *       the closing brace and an existing one has its value replaced. Stage 1 runs again only when the document
+     *       is next walked as a whole, e.g. by `ToString()`.
+     * @note Nodes are slices of the document text; reading a nested value through a `JsonView` runs stage 1 over
+     *       that slice only, and the last few objects and arrays read stay iterated for the next reads.
+     * @note Getters reuse the internal parser, so a single instance must not be read from several threads at once.
+     * @note The document text and nested wrappers come from the `std::pmr::memory_resource` given at construction;
+     *       the parsers keep their own buffers, which are reused across documents.
+     * @note simdjson is not included here: its parsers live behind a pointer, because their layout depends on how
+     *       each translation unit configures simdjson (development checks, threads).
+     */
+    class SimdJsonWrapper final : public IJsonWrapper
+    {
+    public:
+        SimdJsonWrapper();
+
+        /**
+         * @param resource Supplies the document text and nested wrappers; `nullptr` for the default resource. Must
+         *        outlive the wrapper and the wrappers created from it.
+         */
+        explicit SimdJsonWrapper(std::pmr::memory_resource* resource);
+
+        ~SimdJsonWrapper() override;
+
+        SimdJsonWrapper(const SimdJsonWrapper&) = delete;
+
+        SimdJsonWrapper& operator=(const SimdJsonWrapper&) = delete;
+
+        SimdJsonWrapper(SimdJsonWrapper&&) = delete;
+
+        SimdJsonWrapper& operator=(SimdJsonWrapper&&) = delete;
+
+        // non-virtual overloads of `IJsonWrapper`, hidden otherwise by the overrides below
+        using IJsonWrapper::GetBool;
+        using IJsonWrapper::GetDouble;
+        using IJsonWrapper::GetInt;
+        using IJsonWrapper::GetObjectView;
+        using IJsonWrapper::GetString;
+        using IJsonWrapper::GetStringView;
+        using IJsonWrapper::GetUnsigned;
+        using IJsonWrapper::HasKey;
+        using IJsonWrapper::IsNull;
+        using IJsonWrapper::Parse;
+        using IJsonWrapper::SetBool;
+        using IJsonWrapper::SetDouble;
+        using IJsonWrapper::SetInt;
+        using IJsonWrapper::SetNull;
+        using IJsonWrapper::SetObject;
+        using IJsonWrapper::SetString;
+        using IJsonWrapper::SetUnsigned;
+
+        void SetInt(std::string_view key, int64_t value) override;
+
+        void SetUnsigned(std::string_view key, uint64_t value) override;
+
+        void SetDouble(std::string_view key, double value) override;
+
+        void SetBool(std::string_view key, bool value) override;
+
+        void SetString(std::string_view key, std::string_view value) override;
+
+        void SetObject(std::string_view key, std::unique_ptr<IJsonWrapper> jsonObject) override;
+
+        /**
+         * @brief Same as above without the type check, for callers that already hold this backend.
+         */
+        void SetObject(std::string_view key, std::unique_ptr<SimdJsonWrapper> jsonObject);
+
+        void SetNull(std::string_view key) override;
+
+        void SetIntArray(std::string_view key, const int64_t* values, std::size_t count) override;
+
+        void SetUnsignedArray(std::string_view key, const uint64_t* values, std::size_t count) override;
+
+        void SetDoubleArray(std::string_view key, const double* values, std::size_t count) override;
+
+        void SetStringArray(std::string_view key, const std::string_view* values, std::size_t count) override;
+
+        int64_t GetInt(std::string_view key) const override;
+
+        uint64_t GetUnsigned(std::string_view key) const override;
+
+        double GetDouble(std::string_view key) const override;
+
+        bool GetBool(std::string_view key) const override;
+
+        std::string GetString(std::string_view key) const override;
+
+        std::string_view GetStringView(std::string_view key) const override;
+
+        std::unique_ptr<IJsonWrapper> GetObject(std::string_view key) const override;
+
+        bool IsNull(std::string_view key) const override;
+
+        bool HasKey(std::string_view key) const override;
+
+        /**
+         * @note The getters taking a key look it up by hash in an index of the root members, built by the first such
+         *       lookup in one pass over the document and dropped when the document changes.
+         */
+        int64_t GetInt(const JsonKey& key) const override;
+
+        uint64_t GetUnsigned(const JsonKey& key) const override;
+
+        double GetDouble(const JsonKey& key) const override;
+
+        bool GetBool(const JsonKey& key) const override;
+
+        std::string GetString(const JsonKey& key) const override;
+
+        std::string_view GetStringView(const JsonKey& key) const override;
+
+        bool IsNull(const JsonKey& key) const override;
+
+        bool HasKey(const JsonKey& key) const override;
+
+        std::unique_ptr<IJsonWrapper> GetEmptyObject() const override;
+
+        /**
+         * @return @b false: the getters share the wrapper's parsers.
+         */
+        bool AllowsConcurrentReads() const override;
+
+        void Parse(std::string_view inputJson) override;
+
+        /**
+         * @note Copies the text like `Parse()`, but checks only its structure.
+         */
+        void ParseLazy(std::string_view inputJson) override;
+
+        /**
+         * @note The file is mapped with `SIMDJSON_PADDING` spare bytes and indexed in place: the document keeps the
+         *       mapping instead of a copy until it is parsed again or modified.
+         */
+        void ParseFile(const std::string& filePath) override;
+
+        std::string ToString() const override;
+
+    protected:
+        JsonNode RootNode() const override;
+
+        JsonNode MemberNode(JsonNode object, std::string_view key) const override;
+
+        int64_t NodeToInt(JsonNode node) const override;
+
+        uint64_t NodeToUnsigned(JsonNode node) const override;
+
+        double NodeToDouble(JsonNode node) const override;
+
+        bool NodeToBool(JsonNode node) const override;
+
+        std::string_view NodeToStringView(JsonNode node) const override;
+
+        JsonErrorCode NodeTryToInt(JsonNode node, int64_t& value) const override;
+
+        JsonErrorCode NodeTryToUnsigned(JsonNode node, uint64_t& value) const override;
+
+        JsonErrorCode NodeTryToDouble(JsonNode node, double& value) const override;
+
+        JsonErrorCode NodeTryToBool(JsonNode node, bool& value) const override;
+
+        JsonErrorCode NodeTryToStringView(JsonNode node, std::string_view& value) const override;
+
+        bool NodeIsNull(JsonNode node) const override;
+
+        bool NodeIsObject(JsonNode node) const override;
+
+        bool NodeIsArray(JsonNode node) const override;
+
+        /**
+         * @note Counts the elements without decoding them, or takes the count of the array last indexed.
+         */
+        std::size_t NodeArraySize(JsonNode node) const override;
+
+        /**
+         * @note The first index into an array walks it once with `ElementNodes()`; the handles are kept, so that a
+         *       loop over the indices of the same array costs O(1) per element. Only the last array is kept, so
+         *       loops that index into other arrays between two elements should take `ElementNodes()` up front.
+         */
+        JsonNode ElementNode(JsonNode array, std::size_t index) const override;
+
+        /**
+         * @note Walks the array once.
+         */
+        std::vector<JsonNode> ElementNodes(JsonNode array) const override;
+
+        void NodeForEachMember(JsonNode object, IJsonMemberVisitor& visitor) const override;
+
+        std::size_t NodeToIntArray(JsonNode node, int64_t* values, std::size_t capacity) const override;
+
+        std::size_t NodeToUnsignedArray(JsonNode node, uint64_t* values, std::size_t capacity) const override;
+
+        std::size_t NodeToDoubleArray(JsonNode node, double* values, std::size_t capacity) const override;
+
+        std::unique_ptr<IJsonWrapper> NodeToObject(JsonNode node) const override;
+
+        std::string NodeToString(JsonNode node) const override;
+
+        void NodeSerialize(JsonNode node, Details::JsonOutput& output) const override;
+
+        void NodeEmit(JsonNode node, IJsonHandler& handler) const override;
+
+        /**
+         * @note Each thread walks the value with a parser of its own instead of the shared node parser.
+         */
+        void NodeSerializeConcurrent(JsonNode node, Details::JsonOutput& output) const override;
+
+        /**
+         * @note Backed by simdjson's `iterate_many()`: stage 1 runs over whole batches, optionally on a background
+         *       thread, and each document is then loaded like `Parse()` does. The batch is copied once for padding.
+         */
+        std::unique_ptr<IJsonStreamCursor> OpenStream(std::string_view batch,
+                                                      const JsonStreamOptions& options) override;
+
+        /**
+         * @note Each member or array element is checked on its own as it completes and appended to the text in place,
+         *       so that it can be read right away.
+         */
+        std::unique_ptr<IJsonFeedCursor> OpenFeed() override;
+
+    private:
+        /**
+         * @brief Member of the root object in `_keyIndex`.
+         */
+        struct KeyEntry
+        {
+            /**
+             * @brief `std::hash<std::string_view>` of `key`, as in `JsonKey::Hash()`.
+             */
+            std::size_t hash;
+
+            /**
+             * @brief The unescaped key, in the document text or in `_unescapedKeys` if it has escapes.
+             */
+            std::string_view key;
+
+            JsonNode value;
+        };
+
+        /**
+         * @brief simdjson's parsers and the documents they iterate; defined with the implementation.
+         */
+        struct Parsers;
+
+        class StreamCursor;
+
+        class FeedCursor;
+
+        /**
+         * @brief Copy `json` into the padded buffer and index it.
+         * @param checkScalars Check numbers and atoms as well as the structure, as `Parse()` does.
+         * @throw XJsonError If the document is malformed. The wrapper is reset to null in that case.
+         */
+        void Load(std::string_view json, bool checkScalars = true);
+
+        /**
+         * @brief Index the document held by `_buffer`: `length` bytes followed by `SIMDJSON_PADDING` bytes.
+         * @param checkScalars As for `Load()`.
+         * @throw XJsonError If the document is malformed. The wrapper is reset to null in that case.
+         */
+        void Reload(std::size_t length, bool checkScalars);
+
+        /**
+         * @brief Run stage 1 over `length` bytes of the document text at `position`: the whole text, or one value.
+         * @return Whether the text can be iterated.
+         */
+        bool Index(std::size_t position, std::size_t length) const;
+
+        /**
+         * @brief `Index()` the text and check its structure: brackets, separators and trailing content.
+         * @param checkScalars Check the spelling of numbers and atoms as well.
+         * @return Whether the text can be read.
+         */
+        bool Verify(std::size_t position, std::size_t length, bool checkScalars) const;
+
+        /**
+         * @brief Rewind the document so that it can be traversed from the root again.
+         */
+        void Rewind() const;
+
+        /**
+         * @brief Build `_keyIndex` from the members of the root, if not done since the document last changed.
+         */
+        void IndexKeys() const;
+
+        /**
+         * @brief Handle of the top level member `key`, found through `_keyIndex`; the last one if `key` is repeated,
+         *        as in the serialized text.
+         * @param key The unescaped member key.
+         * @param hash `std::hash<std::string_view>` of `key`.
+         * @return Empty handle if the document is not an object or doesn't contain `key`.
+         */
+        JsonNode KeyNode(std::string_view key, std::size_t hash) const;
+
+        /**
+         * @brief Same as above, hashing `key` first.
+         */
+        JsonNode KeyNode(std::string_view key) const;
+
+        /**
+         * @brief Whether `node` is the whole document.
+         */
+        bool IsRoot(JsonNode node) const;
+
+        /**
+         * @brief The text of a value, without leading and trailing whitespace.
+         */
+        std::string_view NodeText(JsonNode node) const;
+
+        /**
+         * @brief Iterate a value from its start: the main document for the root, a document kept for each of the
+         *        objects and arrays read last, a document of its own for scalars.
+         * @return The `simdjson::ondemand::document`, left to be deduced so that this header doesn't name it.
+         * @note Stage 1 runs over a nested object or array the first time it is read only; later reads through the
+         *       same handle rewind the document kept for it.
+         * @throw XJsonError with `errorMessage` if the handle is empty.
+         */
+        auto& NodeDocument(JsonNode node, const char* errorMessage) const;
+
+        /**
+         * @brief The string of a value without escapes, as a slice of the text.
+         * @return Whether `value` was set: `false` if the value has escapes or is not a string.
+         */
+        bool NodeRawString(JsonNode node, std::string_view& value) const;
+
+        /**
+         * @brief A copy of the string of a value, unescaped without keeping it in `_unescapedStrings`.
+         * @throw XJsonError If the value is not a string.
+         */
+        std::string NodeCopyString(JsonNode node) const;
+
+        /**
+         * @brief Convert a value with simdjson's `get()`, like the throwing conversions but reporting the error.
+         * @tparam TValue `int64_t`, `uint64_t`, `double`, `bool` or `std::string_view`.
+         */
+        template<typename TValue>
+        JsonErrorCode NodeTryTo(JsonNode node, TValue& value) const;
+
+        /**
+         * @brief Convert every element of an array with simdjson's number parser, straight into `values`.
+         * @tparam TNumber `int64_t`, `uint64_t` or `double`.
+         * @throw XJsonError with `errorMessage` if the value is not an array, an element fails conversion or the
+         *        array has more than `capacity` elements.
+         */
+        template<typename TNumber>
+        std::size_t NodeToNumbers(JsonNode node, TNumber* values, std::size_t capacity, const char* errorMessage) const;
+
+        /**
+         * @brief Insert or replace a top level member.
+         * @param key The unescaped member key.
+         * @param rawValue The member value as serialized JSON.
+         * @throw XJsonError If the document is neither null nor an object.
+         */
+        void SetMember(std::string_view key, std::string_view rawValue);
+
+        /**
+         * @brief Replace `removed` bytes of the document text at `position` with `inserted`, in `_buffer`.
+         * @note `_keyIndex` is moved along with the text; the iterator is indexed again when next needed.
+         */
+        void EditText(std::size_t position, std::size_t removed, std::string_view inserted);
+
+        /**
+         * @brief Drop the documents kept for nested objects and arrays, the elements of `_elements` and the strings of
+         *        `_unescapedStrings`, once the text they point into changed.
+         */
+        void ForgetNodes() const;
+
+        /**
+         * @brief The document text, without padding.
+         */
+        std::string_view Text() const;
+
+        /**
+         * @brief The resource the text and nested wrappers are allocated from, `nullptr` for the default one.
+         */
+        std::pmr::memory_resource* _resource;
+
+        /**
+         * @brief Document text followed by `SIMDJSON_PADDING` bytes, reused across `Parse()` calls.
+         */
+        std::pmr::string _buffer;
+
+        /**
+         * @brief The file adopted by `ParseFile()`; empty when the document lives in `_buffer`.
+         */
+        Details::MappedFile _mappedFile;
+
+        /**
+         * @brief The document text: in `_buffer` or in `_mappedFile`.
+         */
+        const char* _text{nullptr};
+
+        /**
+         * @brief Length of the document text.
+         */
+        std::size_t _length{0};
+
+        /**
+         * @brief Bytes readable from `_text`, padding included.
+         */
+        std::size_t _capacity{0};
+
+        /**
+         * @brief The parsers, whose internal buffers grow to the largest document seen, and their documents.
+         */
+        std::unique_ptr<Parsers> _parsers;
+
+        /**
+         * @brief Whether the document iterating the text can be rewound; fatal simdjson errors invalidate it.
+         */
+        mutable bool _rewindable{false};
+
+        /**
+         * @brief Strings with escapes handed out by `GetStringView()`, by the text of their value: the parser's
+         *        scratch buffer is reused by every lookup, so each one is unescaped once and kept until the text
+         *        changes.
+         */
+        mutable std::unordered_map<const void*, std::string> _unescapedStrings;
+
+        /**
+         * @brief The unescaped keys of `_keyIndex` that have escapes. Cleared along with the index.
+         */
+        mutable std::deque<std::string> _unescapedKeys;
+
+        /**
+         * @brief Members of the root object sorted by hash, in document order among equal hashes; empty if the root
+         *        is not an object. Kept up to date by the setters.
+         */
+        mutable std::vector<KeyEntry> _keyIndex;
+
+        /**
+         * @brief Whether `_keyIndex` matches the document.
+         */
+        mutable bool _keysIndexed{false};
+
+        /**
+         * @brief The array whose elements are in `_elements`, so that indexed access doesn't walk it again.
+         */
+        mutable JsonNode _elementsOf;
+
+        /**
+         * @brief Handles of the elements of `_elementsOf`.
+         */
+        mutable std::vector<JsonNode> _elements;
+
+        /**
+         * @brief Number of `NodeForEachMember()` calls in progress.
+         */
+        mutable std::size_t _memberDepth{0};
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INCLUDES_SIMDJSONWRAPPER_HPP_
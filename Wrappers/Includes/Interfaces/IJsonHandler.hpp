@@ -0,0 +1,55 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_IJSONHANDLER_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_IJSONHANDLER_HPP_
+
+#include <cstdint>
+#include <string_view>
+
+namespace Wrappers
+{
+    /**
+     * @interface IJsonHandler
+     * @brief Receives a value as a sequence of events in document order: a member is `Key()` followed by its value,
+     *        and an array or object is its elements or members between `Begin*()` and `End*()`.
+     * @note `Wrappers::JsonWriter` writes the events as text; backends build their tree from them when
+     *       `IJsonWrapper::SetObject()` is given a child of another backend.
+     */
+    class IJsonHandler
+    {
+    public:
+        virtual ~IJsonHandler() = default;
+
+        virtual void BeginObject() = 0;
+
+        virtual void EndObject() = 0;
+
+        virtual void BeginArray() = 0;
+
+        virtual void EndArray() = 0;
+
+        /**
+         * @param key The unescaped key. Valid for the duration of the call only.
+         */
+        virtual void Key(std::string_view key) = 0;
+
+        virtual void Int(int64_t value) = 0;
+
+        virtual void Unsigned(uint64_t value) = 0;
+
+        virtual void Double(double value) = 0;
+
+        virtual void Bool(bool value) = 0;
+
+        /**
+         * @param value The unescaped value. Valid for the duration of the call only.
+         */
+        virtual void String(std::string_view value) = 0;
+
+        virtual void Null() = 0;
+
+    protected:
+        IJsonHandler() = default;
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_IJSONHANDLER_HPP_
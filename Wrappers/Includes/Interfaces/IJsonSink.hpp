@@ -0,0 +1,30 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_IJSONSINK_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_IJSONSINK_HPP_
+
+#include <string_view>
+
+namespace Wrappers
+{
+    /**
+     * @interface IJsonSink
+     * @brief Receives serialized JSON in chunks, e.g. to fill pooled or `writev()`-ready buffers.
+     * @see IJsonWrapper::SerializeTo(IJsonSink&)
+     */
+    class IJsonSink
+    {
+    public:
+        virtual ~IJsonSink() = default;
+
+        /**
+         * @brief Consume the next chunk of the document.
+         * @param chunk The bytes that follow the previous chunk. Only valid during the call.
+         */
+        virtual void Write(std::string_view chunk) = 0;
+
+    protected:
+        IJsonSink() = default;
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_IJSONSINK_HPP_
@@ -1,22 +1,90 @@
 #ifndef _INCLUDE_JSON_WRAPPER_SRC_IJSONWRAPPER_HPP_
 #define _INCLUDE_JSON_WRAPPER_SRC_IJSONWRAPPER_HPP_
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <memory_resource>
+#include <new>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Interfaces/IJsonHandler.hpp"
+#include "Interfaces/IJsonSink.hpp"
+#include "Interfaces/JsonBinaryFormat.hpp"
+#include "Interfaces/JsonFeedParser.hpp"
+#include "Interfaces/JsonKey.hpp"
+#include "Interfaces/JsonPath.hpp"
+#include "Interfaces/JsonResult.hpp"
+#include "Interfaces/JsonStream.hpp"
+#include "Interfaces/JsonView.hpp"
 
 namespace Wrappers
 {
+    namespace Details
+    {
+        class JsonOutput;
+    }
+
     /**
      * @interface IJsonWrapper
      * @brief Json wrapper contract for simple JSON types.
-     * @note Doesn't contain support for arrays yet.
+     * @note Arrays are set and read as a whole; numeric arrays are converted in one pass into caller memory.
      * @note Default object state is 'null' instead of empty object("{}").
+     * @note Keys are taken as `std::string_view` so that literals and slices of a buffer are looked up without
+     *       building a `std::string`.
      */
     class IJsonWrapper
     {
     public:
         virtual ~IJsonWrapper() = default;
 
+        // #region Allocation
+
+        /**
+         * @brief Allocate a wrapper from the default memory resource.
+         * @note Wrappers carry a tag naming the resource they come from, so that `delete`, e.g. through a
+         *       `std::unique_ptr<IJsonWrapper>`, releases nested wrappers created from a request arena as well.
+         */
+        static void* operator new(std::size_t size);
+
+        /**
+         * @brief Allocate a wrapper from `resource`: `new (resource) NlohmannPmrJsonWrapper{resource}`.
+         */
+        static void* operator new(std::size_t size, std::pmr::memory_resource* resource);
+
+        /**
+         * @brief The forms above for wrappers of a subclass declared `alignas` beyond `std::max_align_t`, which would
+         *        otherwise be allocated at the alignment of the tag.
+         */
+        static void* operator new(std::size_t size, std::align_val_t alignment);
+
+        static void* operator new(std::size_t size, std::align_val_t alignment, std::pmr::memory_resource* resource);
+
+        /**
+         * @brief Construct a wrapper in storage of the caller, as the global placement form hidden by the overloads
+         *        above would: `new (&storage) SimdJsonWrapper{}`.
+         * @note The storage carries no tag, so the wrapper is ended by calling its destructor, never by `delete`.
+         */
+        static void* operator new(std::size_t size, void* place) noexcept;
+
+        static void operator delete(void* memory) noexcept;
+
+        static void operator delete(void* memory, std::pmr::memory_resource* resource) noexcept;
+
+        static void operator delete(void* memory, std::align_val_t alignment) noexcept;
+
+        static void operator delete(void* memory,
+                                    std::align_val_t alignment,
+                                    std::pmr::memory_resource* resource) noexcept;
+
+        static void operator delete(void* memory, void* place) noexcept;
+
+        // #endregion
+
         // #region Setters
 
         /**
@@ -25,7 +93,7 @@ namespace Wrappers
          * @param value The value to set.
          * @throw XJsonError If the operation fails.
          */
-        virtual void SetInt(const std::string& key, int64_t value) = 0;
+        virtual void SetInt(std::string_view key, int64_t value) = 0;
 
         /**
          * @brief Set an unsigned integer value in the JSON object.
@@ -33,7 +101,7 @@ namespace Wrappers
          * @param value The value to set.
          * @throw XJsonError If the operation fails.
          */
-        virtual void SetUnsigned(const std::string& key, uint64_t value) = 0;
+        virtual void SetUnsigned(std::string_view key, uint64_t value) = 0;
 
         /**
          * @brief Set a double value in the JSON object.
@@ -41,7 +109,7 @@ namespace Wrappers
          * @param value The value to set.
          * @throw XJsonError If the operation fails.
          */
-        virtual void SetDouble(const std::string& key, double value) = 0;
+        virtual void SetDouble(std::string_view key, double value) = 0;
 
         /**
          * @brief Set a boolean value in the JSON object.
@@ -49,7 +117,7 @@ namespace Wrappers
          * @param value The value to set.
          * @throw XJsonError If the operation fails.
          */
-        virtual void SetBool(const std::string& key, bool value) = 0;
+        virtual void SetBool(std::string_view key, bool value) = 0;
 
         /**
          * @brief Set a string value in the JSON object.
@@ -57,22 +125,51 @@ namespace Wrappers
          * @param value The value to set.
          * @throw XJsonError If the operation fails.
          */
-        virtual void SetString(const std::string& key, const std::string& value) = 0;
+        virtual void SetString(std::string_view key, std::string_view value) = 0;
 
         /**
          * @brief Set an inner JSON object.
          * @param key The key to set.
          * @param jsonObjec The object to set.
          * @throw XJsonError If the operation fails.
+         * @note A child of the same backend is moved in. A child of another backend is converted from its
+         *       `NodeEmit()` events, without a serialize and parse round trip.
          */
-        virtual void SetObject(const std::string& key, std::unique_ptr<IJsonWrapper> jsonObject) = 0;
+        virtual void SetObject(std::string_view key, std::unique_ptr<IJsonWrapper> jsonObject) = 0;
 
         /**
          * @brief Set a null value in the JSON object.
          * @param key The key to set.
          * @throw XJsonError If the operation fails.
          */
-        virtual void SetNull(const std::string& key) = 0;
+        virtual void SetNull(std::string_view key) = 0;
+
+        /**
+         * @brief Set an array of integers in the JSON object.
+         * @param key The key to set.
+         * @param values The elements to set.
+         * @param count Number of elements in `values`.
+         * @throw XJsonError If the operation fails.
+         */
+        virtual void SetIntArray(std::string_view key, const int64_t* values, std::size_t count) = 0;
+
+        /**
+         * @brief Set an array of unsigned integers in the JSON object.
+         * @throw XJsonError If the operation fails.
+         */
+        virtual void SetUnsignedArray(std::string_view key, const uint64_t* values, std::size_t count) = 0;
+
+        /**
+         * @brief Set an array of doubles in the JSON object.
+         * @throw XJsonError If the operation fails.
+         */
+        virtual void SetDoubleArray(std::string_view key, const double* values, std::size_t count) = 0;
+
+        /**
+         * @brief Set an array of strings in the JSON object.
+         * @throw XJsonError If the operation fails.
+         */
+        virtual void SetStringArray(std::string_view key, const std::string_view* values, std::size_t count) = 0;
 
         // #endregion
 
@@ -84,7 +181,7 @@ namespace Wrappers
          * @return The integer value associated with the key.
          * @throw XJsonError If the key doesn't exist or type conversion fails.
          */
-        virtual int64_t GetInt(const std::string& key) const = 0;
+        virtual int64_t GetInt(std::string_view key) const = 0;
 
         /**
          * @brief Get an unsigned integer value from the JSON object.
@@ -92,7 +189,7 @@ namespace Wrappers
          * @return The unsigned integer value associated with the key.
          * @throw XJsonError If the key doesn't exist or type conversion fails.
          */
-        virtual uint64_t GetUnsigned(const std::string& key) const = 0;
+        virtual uint64_t GetUnsigned(std::string_view key) const = 0;
 
         /**
          * @brief Get a double value from the JSON object.
@@ -100,7 +197,7 @@ namespace Wrappers
          * @return The double value associated with the key.
          * @throw XJsonError If the key doesn't exist or type conversion fails.
          */
-        virtual double GetDouble(const std::string& key) const = 0;
+        virtual double GetDouble(std::string_view key) const = 0;
 
         /**
          * @brief Get an boolean value from the JSON object.
@@ -108,7 +205,7 @@ namespace Wrappers
          * @return The boolean value associated with the key.
          * @throw XJsonError If the key doesn't exist or type conversion fails.
          */
-        virtual bool GetBool(const std::string& key) const = 0;
+        virtual bool GetBool(std::string_view key) const = 0;
 
         /**
          * @brief Get a string value from the JSON object.
@@ -116,7 +213,16 @@ namespace Wrappers
          * @return The string value associated with the key.
          * @throw XJsonError If the key doesn't exist or type conversion fails.
          */
-        virtual std::string GetString(const std::string& key) const = 0;
+        virtual std::string GetString(std::string_view key) const = 0;
+
+        /**
+         * @brief Get a string value from the JSON object without copying it.
+         * @param key The key to lookup.
+         * @return View of the string value associated with the key.
+         * @throw XJsonError If the key doesn't exist or type conversion fails.
+         * @note The view borrows from the document and is invalidated by any setter, `Parse()` or destruction.
+         */
+        virtual std::string_view GetStringView(std::string_view key) const = 0;
 
         /**
          * @brief Get an inner object copy from the JSON object.
@@ -124,7 +230,83 @@ namespace Wrappers
          * @return The inner object copy associated with the key.
          * @throw XJsonError If the key doesn't exist or type conversion fails.
          */
-        virtual std::unique_ptr<IJsonWrapper> GetObject(const std::string& key) const = 0;
+        virtual std::unique_ptr<IJsonWrapper> GetObject(std::string_view key) const = 0;
+
+        /**
+         * @brief Get a non-owning view of an inner object, without copying it.
+         * @param key The key to lookup.
+         * @return View of the inner object associated with the key.
+         * @throw XJsonError If the key doesn't exist or the value is not an object.
+         * @note The view is invalidated by any setter, `Parse()` or destruction of this object.
+         */
+        JsonView GetObjectView(std::string_view key) const;
+
+        /**
+         * @brief Get a non-owning view of the whole document.
+         */
+        JsonView View() const;
+
+        /**
+         * @brief Get a non-owning view of an array, to iterate it with `JsonView::Size()` and `JsonView::Element()`.
+         * @param key The key to lookup.
+         * @return View of the array associated with the key.
+         * @throw XJsonError If the key doesn't exist or the value is not an array.
+         * @note The view is invalidated by any setter, `Parse()` or destruction of this object.
+         */
+        JsonView GetArrayView(std::string_view key) const;
+
+        /**
+         * @brief Get the number of elements of an array.
+         * @throw XJsonError If the key doesn't exist or the value is not an array.
+         */
+        std::size_t GetArraySize(std::string_view key) const;
+
+        /**
+         * @brief Convert an array of integers in a single pass.
+         * @param key The key to lookup.
+         * @param values Replaced by the elements of the array; its capacity is reused.
+         * @throw XJsonError If the key doesn't exist, the value is not an array or an element fails conversion.
+         */
+        void GetIntArray(std::string_view key, std::vector<int64_t>& values) const;
+
+        /**
+         * @brief Convert an array of integers in a single pass into caller provided memory.
+         * @param key The key to lookup.
+         * @param values Receives the elements of the array.
+         * @param capacity Number of elements `values` can hold.
+         * @return Number of elements written.
+         * @throw XJsonError If the key doesn't exist, the value is not an array, an element fails conversion or the
+         *        array has more than `capacity` elements.
+         */
+        std::size_t GetIntArray(std::string_view key, int64_t* values, std::size_t capacity) const;
+
+        /**
+         * @brief Convert an array of unsigned integers in a single pass.
+         * @throw XJsonError If the key doesn't exist, the value is not an array or an element fails conversion.
+         */
+        void GetUnsignedArray(std::string_view key, std::vector<uint64_t>& values) const;
+
+        /**
+         * @brief Convert an array of unsigned integers in a single pass into caller provided memory.
+         * @return Number of elements written.
+         * @throw XJsonError If the key doesn't exist, the value is not an array, an element fails conversion or the
+         *        array has more than `capacity` elements.
+         */
+        std::size_t GetUnsignedArray(std::string_view key, uint64_t* values, std::size_t capacity) const;
+
+        /**
+         * @brief Convert an array of doubles in a single pass.
+         * @throw XJsonError If the key doesn't exist, the value is not an array or an element fails conversion.
+         */
+        void GetDoubleArray(std::string_view key, std::vector<double>& values) const;
+
+        /**
+         * @brief Convert an array of doubles in a single pass into caller provided memory.
+         * @return Number of elements written.
+         * @throw XJsonError If the key doesn't exist, the value is not an array, an element fails conversion or the
+         *        array has more than `capacity` elements.
+         */
+        std::size_t GetDoubleArray(std::string_view key, double* values, std::size_t capacity) const;
 
         /**
          * @brief Check if a value is null.
@@ -132,14 +314,14 @@ namespace Wrappers
          * @return @b true if the value is null, @b false otherwise.
          * @throw XJsonError If the key doesn't exist.
          */
-        virtual bool IsNull(const std::string& key) const = 0;
+        virtual bool IsNull(std::string_view key) const = 0;
 
         /**
          * @brief Checks if a key is present in the JSON object.
          * @param key The key to check.
          * @return @b true if the key is present, otherwise @b false.
          */
-        virtual bool HasKey(const std::string& key) const = 0;
+        virtual bool HasKey(std::string_view key) const = 0;
 
         /**
          * @brief Create an empty JSON object.
@@ -148,16 +330,320 @@ namespace Wrappers
          */
         virtual std::unique_ptr<IJsonWrapper> GetEmptyObject() const = 0;
 
+        /**
+         * @brief Whether the getters may run on several threads at once while nothing modifies the document, so that
+         *        it can be shared, e.g. by a `JsonDocumentCache`.
+         * @return @b false unless the backend says otherwise.
+         */
+        virtual bool AllowsConcurrentReads() const;
+
+        // #endregion
+
+        // #region Path_Access
+
+        /**
+         * @brief Set an integer value at a nested location, creating missing intermediate objects.
+         * @param path The location to set. Must not be the whole document.
+         * @param value The value to set.
+         * @throw XJsonError If an intermediate value is neither null nor an object, or the operation fails.
+         */
+        void SetInt(const JsonPath& path, int64_t value);
+
+        /**
+         * @brief Set an unsigned integer value at a nested location, creating missing intermediate objects.
+         * @throw XJsonError If an intermediate value is neither null nor an object, or the operation fails.
+         */
+        void SetUnsigned(const JsonPath& path, uint64_t value);
+
+        /**
+         * @brief Set a double value at a nested location, creating missing intermediate objects.
+         * @throw XJsonError If an intermediate value is neither null nor an object, or the operation fails.
+         */
+        void SetDouble(const JsonPath& path, double value);
+
+        /**
+         * @brief Set a boolean value at a nested location, creating missing intermediate objects.
+         * @throw XJsonError If an intermediate value is neither null nor an object, or the operation fails.
+         */
+        void SetBool(const JsonPath& path, bool value);
+
+        /**
+         * @brief Set a string value at a nested location, creating missing intermediate objects.
+         * @throw XJsonError If an intermediate value is neither null nor an object, or the operation fails.
+         */
+        void SetString(const JsonPath& path, std::string_view value);
+
+        /**
+         * @brief Set an inner JSON object at a nested location, creating missing intermediate objects.
+         * @throw XJsonError If an intermediate value is neither null nor an object, or the operation fails.
+         */
+        void SetObject(const JsonPath& path, std::unique_ptr<IJsonWrapper> jsonObject);
+
+        /**
+         * @brief Set a null value at a nested location, creating missing intermediate objects.
+         * @throw XJsonError If an intermediate value is neither null nor an object, or the operation fails.
+         */
+        void SetNull(const JsonPath& path);
+
+        /**
+         * @brief Get an integer value at a nested location.
+         * @param path The location to lookup.
+         * @return The integer value at the location.
+         * @throw XJsonError If the location doesn't exist or type conversion fails.
+         */
+        int64_t GetInt(const JsonPath& path) const;
+
+        /**
+         * @brief Get an unsigned integer value at a nested location.
+         * @throw XJsonError If the location doesn't exist or type conversion fails.
+         */
+        uint64_t GetUnsigned(const JsonPath& path) const;
+
+        /**
+         * @brief Get a double value at a nested location.
+         * @throw XJsonError If the location doesn't exist or type conversion fails.
+         */
+        double GetDouble(const JsonPath& path) const;
+
+        /**
+         * @brief Get a boolean value at a nested location.
+         * @throw XJsonError If the location doesn't exist or type conversion fails.
+         */
+        bool GetBool(const JsonPath& path) const;
+
+        /**
+         * @brief Get a copy of a string value at a nested location.
+         * @throw XJsonError If the location doesn't exist or type conversion fails.
+         */
+        std::string GetString(const JsonPath& path) const;
+
+        /**
+         * @brief Get a string value at a nested location without copying it.
+         * @throw XJsonError If the location doesn't exist or type conversion fails.
+         * @note The view is invalidated by any setter, `Parse()` or destruction of this object.
+         */
+        std::string_view GetStringView(const JsonPath& path) const;
+
+        /**
+         * @brief Get a non-owning view of the object at a nested location.
+         * @throw XJsonError If the location doesn't exist or the value is not an object.
+         */
+        JsonView GetObjectView(const JsonPath& path) const;
+
+        /**
+         * @brief Get a non-owning view of the array at a nested location.
+         * @throw XJsonError If the location doesn't exist or the value is not an array.
+         */
+        JsonView GetArrayView(const JsonPath& path) const;
+
+        /**
+         * @brief Check if the value at a nested location is null.
+         * @throw XJsonError If the location doesn't exist.
+         */
+        bool IsNull(const JsonPath& path) const;
+
+        /**
+         * @brief Checks if a nested location exists.
+         */
+        bool HasKey(const JsonPath& path) const;
+
+        // #endregion
+
+        // #region Key_Access
+
+        /**
+         * @brief Set an integer value under a pre-hashed key, like `SetInt(key.Name(), value)`.
+         * @note The setters taking a key set it by name on every backend; see `JsonKey` for which getters use the
+         *       hash.
+         */
+        void SetInt(const JsonKey& key, int64_t value);
+
+        /**
+         * @brief Set an unsigned integer value under a pre-hashed key.
+         */
+        void SetUnsigned(const JsonKey& key, uint64_t value);
+
+        /**
+         * @brief Set a double value under a pre-hashed key.
+         */
+        void SetDouble(const JsonKey& key, double value);
+
+        /**
+         * @brief Set a boolean value under a pre-hashed key.
+         */
+        void SetBool(const JsonKey& key, bool value);
+
+        /**
+         * @brief Set a string value under a pre-hashed key.
+         */
+        void SetString(const JsonKey& key, std::string_view value);
+
+        /**
+         * @brief Set an inner JSON object under a pre-hashed key.
+         */
+        void SetObject(const JsonKey& key, std::unique_ptr<IJsonWrapper> jsonObject);
+
+        /**
+         * @brief Set a null value under a pre-hashed key.
+         */
+        void SetNull(const JsonKey& key);
+
+        /**
+         * @brief Get an integer value through a pre-hashed key.
+         * @param key The key to lookup.
+         * @return The integer value of the key.
+         * @throw XJsonError If the key doesn't exist or type conversion fails.
+         * @note The getters taking a key look it up by name by default; backends that can use its hash override them.
+         */
+        virtual int64_t GetInt(const JsonKey& key) const;
+
+        /**
+         * @brief Get an unsigned integer value through a pre-hashed key.
+         * @throw XJsonError If the key doesn't exist or type conversion fails.
+         */
+        virtual uint64_t GetUnsigned(const JsonKey& key) const;
+
+        /**
+         * @brief Get a double value through a pre-hashed key.
+         * @throw XJsonError If the key doesn't exist or type conversion fails.
+         */
+        virtual double GetDouble(const JsonKey& key) const;
+
+        /**
+         * @brief Get a boolean value through a pre-hashed key.
+         * @throw XJsonError If the key doesn't exist or type conversion fails.
+         */
+        virtual bool GetBool(const JsonKey& key) const;
+
+        /**
+         * @brief Get a copy of a string value through a pre-hashed key.
+         * @throw XJsonError If the key doesn't exist or type conversion fails.
+         */
+        virtual std::string GetString(const JsonKey& key) const;
+
+        /**
+         * @brief Get a string value through a pre-hashed key without copying it.
+         * @throw XJsonError If the key doesn't exist or type conversion fails.
+         * @note The view is invalidated by any setter, `Parse()` or destruction of this object.
+         */
+        virtual std::string_view GetStringView(const JsonKey& key) const;
+
+        /**
+         * @brief Check if the value of a pre-hashed key is null.
+         * @throw XJsonError If the key doesn't exist.
+         */
+        virtual bool IsNull(const JsonKey& key) const;
+
+        /**
+         * @brief Checks if a pre-hashed key exists.
+         */
+        virtual bool HasKey(const JsonKey& key) const;
+
+        // #endregion
+
+        // #region Try_Getters
+
+        /**
+         * @brief Get an integer value, reporting a miss instead of throwing.
+         * @param key The key to lookup.
+         * @return The value, or `NoSuchKey` / `IncorrectType`.
+         * @note Follows the conversion rules of `GetInt()`. No exception is thrown or caught on a miss, so that
+         *       optional fields are cheap to probe.
+         */
+        JsonResult<int64_t> TryGetInt(std::string_view key) const;
+
+        /**
+         * @brief Get an unsigned integer value, reporting a miss instead of throwing.
+         */
+        JsonResult<uint64_t> TryGetUnsigned(std::string_view key) const;
+
+        /**
+         * @brief Get a double value, reporting a miss instead of throwing.
+         */
+        JsonResult<double> TryGetDouble(std::string_view key) const;
+
+        /**
+         * @brief Get a boolean value, reporting a miss instead of throwing.
+         */
+        JsonResult<bool> TryGetBool(std::string_view key) const;
+
+        /**
+         * @brief Get a copy of a string value, reporting a miss instead of throwing.
+         */
+        JsonResult<std::string> TryGetString(std::string_view key) const;
+
+        /**
+         * @brief Get a string value without copying it, reporting a miss instead of throwing.
+         * @note The view is invalidated like the one of `GetStringView()`.
+         */
+        JsonResult<std::string_view> TryGetStringView(std::string_view key) const;
+
+        /**
+         * @brief Get an integer value at a nested location, reporting a miss instead of throwing.
+         */
+        JsonResult<int64_t> TryGetInt(const JsonPath& path) const;
+
+        /**
+         * @brief Get an unsigned integer value at a nested location, reporting a miss instead of throwing.
+         */
+        JsonResult<uint64_t> TryGetUnsigned(const JsonPath& path) const;
+
+        /**
+         * @brief Get a double value at a nested location, reporting a miss instead of throwing.
+         */
+        JsonResult<double> TryGetDouble(const JsonPath& path) const;
+
+        /**
+         * @brief Get a boolean value at a nested location, reporting a miss instead of throwing.
+         */
+        JsonResult<bool> TryGetBool(const JsonPath& path) const;
+
+        /**
+         * @brief Get a copy of a string value at a nested location, reporting a miss instead of throwing.
+         */
+        JsonResult<std::string> TryGetString(const JsonPath& path) const;
+
+        /**
+         * @brief Get a string value at a nested location without copying it, reporting a miss instead of throwing.
+         */
+        JsonResult<std::string_view> TryGetStringView(const JsonPath& path) const;
+
         // #endregion
 
         // #region Seraialization_Deserialization
 
         /**
          * @brief Parse a JSON string.
-         * @param jsonString The string to parse.
+         * @param jsonString The string to parse. It is not referenced after the call returns.
+         * @throw XJsonError If parsing fails.
+         */
+        virtual void Parse(std::string_view jsonString) = 0;
+
+        /**
+         * @brief Parse a JSON string given as a pointer and a length; it doesn't need to be NUL terminated.
          * @throw XJsonError If parsing fails.
          */
-        virtual void Parse(const std::string& jsonString) = 0;
+        void Parse(const char* jsonString, std::size_t length);
+
+        /**
+         * @brief Parse a JSON string, decoding member values only when they are first read.
+         * @param jsonString The string to parse. Backends with a lazy mode reference it rather than copy it: it must
+         *        stay valid and unchanged until the document is parsed again, modified or destroyed.
+         * @throw XJsonError If the structure of the document is broken. A malformed value may only be reported by the
+         *        call that reads it, or by the first setter.
+         * @note Meant for reading a few members of a large object. Backends without a lazy mode parse eagerly, like
+         *       `Parse()`.
+         */
+        virtual void ParseLazy(std::string_view jsonString);
+
+        /**
+         * @brief Parse a JSON file.
+         * @param filePath The file to parse.
+         * @throw XJsonError If the file cannot be read or parsing fails.
+         * @note The file is memory-mapped rather than read into a string, so only the pages the parser touches
+         *       become resident. Backends that can keep their document in the mapping do so and don't copy it.
+         */
+        virtual void ParseFile(const std::string& filePath);
 
         /**
          * @brief Convert the JSON object to a string representation.
@@ -167,12 +653,313 @@ namespace Wrappers
          */
         virtual std::string ToString() const = 0;
 
+        /**
+         * @brief Serialize into `output`, in the same form as `ToString()`.
+         * @param output Replaced by the document; its capacity is reused, so a pooled string doesn't reallocate.
+         * @throw XJsonError Same as `ToString()`. `output` holds a truncated document in that case.
+         */
+        void SerializeTo(std::string& output) const;
+
+        /**
+         * @brief Serialize into a caller buffer, in the same form as `ToString()`. No terminating NUL is written.
+         * @return Length of the document. If it exceeds `capacity`, only the first `capacity` bytes were written
+         *         and the call can be repeated with a large enough buffer.
+         * @throw XJsonError Same as `ToString()`.
+         */
+        std::size_t SerializeTo(char* buffer, std::size_t capacity) const;
+
+        /**
+         * @brief Serialize into `sink`, in the same form as `ToString()`, a few kilobytes at a time.
+         * @return Length of the document.
+         * @throw XJsonError Same as `ToString()`, or whatever `sink` throws. Part of the document may have been
+         *        written to the sink already.
+         */
+        std::size_t SerializeTo(IJsonSink& sink) const;
+
+        /**
+         * @brief Serialize into `output` on several threads, byte for byte as `SerializeTo()`.
+         * @param output Replaced by the document.
+         * @param threadCount Threads serializing, the calling one included; 0 for one per hardware thread.
+         * @throw XJsonError Same as `ToString()`.
+         * @note Meant for documents of hundreds of megabytes. The members of the root object, or the elements of the
+         *       root array, are split into pieces serialized into buffers of their own and then concatenated; a root
+         *       holding a single object or array is descended into first. Scalar roots are serialized serially.
+         */
+        void SerializeParallel(std::string& output, std::size_t threadCount = 0) const;
+
+        /**
+         * @brief Serialize on several threads like the overload above, leaving the document in consecutive pieces,
+         *        e.g. to hand to `writev()` without concatenating them.
+         * @param pieces Replaced by the pieces; joined in order they are the document.
+         */
+        void SerializeParallel(std::vector<std::string>& pieces, std::size_t threadCount = 0) const;
+
+        /**
+         * @brief Encode the document in a binary format, e.g. for hops between services that would otherwise format
+         *        and parse every number as text.
+         * @throw XJsonError Same as `ToString()`.
+         * @note Round-trips losslessly with the text form: `ParseBinary()` of the bytes yields a document whose
+         *       `ToString()` is identical. Backends without a binary codec of their own transcode through the text.
+         */
+        virtual std::vector<std::uint8_t> ToBinary(JsonBinaryFormat format) const;
+
+        /**
+         * @brief Parse a document encoded in a binary format, e.g. by `ToBinary()` of any backend.
+         * @param format The encoding of `bytes`.
+         * @param bytes The document. It is not referenced after the call returns.
+         * @param size Length of `bytes`.
+         * @throw XJsonError If `bytes` is not a valid document of `format`, or holds a value JSON has no counterpart
+         *        for, such as a CBOR byte string.
+         */
+        virtual void ParseBinary(JsonBinaryFormat format, const std::uint8_t* bytes, std::size_t size);
+
         // #endregion
 
     protected:
         IJsonWrapper() = default;
+
+        /**
+         * @brief Create a nested wrapper in the memory resource of its parent.
+         * @param resource The parent's resource; `nullptr` for the default one.
+         */
+        template<typename TJsonWrapper, typename... TArgs>
+        static std::unique_ptr<TJsonWrapper> MakeNested(std::pmr::memory_resource* resource, TArgs&&... args)
+        {
+            return std::unique_ptr<TJsonWrapper>{new (resource) TJsonWrapper(std::forward<TArgs>(args)...)};
+        }
+
+        /**
+         * @brief Pass the root of `document` to `handler` as events, for a backend to convert a child of another
+         *        backend given to `SetObject()`.
+         */
+        static void EmitDocument(const IJsonWrapper& document, IJsonHandler& handler);
+
+        friend class JsonFeedParser;
+        friend class JsonStream;
+        friend class JsonView;
+        friend class JsonWriter;
+
+        // #region Node_Access
+
+        /**
+         * @brief Handle of the root value.
+         */
+        virtual JsonNode RootNode() const = 0;
+
+        /**
+         * @brief Handle of the member `key` of `object`.
+         * @return Empty handle if `object` is empty, not an object or doesn't contain `key`.
+         */
+        virtual JsonNode MemberNode(JsonNode object, std::string_view key) const = 0;
+
+        /**
+         * @brief Convert a value to an integer.
+         * @throw XJsonError If the handle is empty or type conversion fails.
+         */
+        virtual int64_t NodeToInt(JsonNode node) const = 0;
+
+        /**
+         * @brief Convert a value to an unsigned integer.
+         * @throw XJsonError If the handle is empty or type conversion fails.
+         */
+        virtual uint64_t NodeToUnsigned(JsonNode node) const = 0;
+
+        /**
+         * @brief Convert a value to a double.
+         * @throw XJsonError If the handle is empty or type conversion fails.
+         */
+        virtual double NodeToDouble(JsonNode node) const = 0;
+
+        /**
+         * @brief Convert a value to a boolean.
+         * @throw XJsonError If the handle is empty or type conversion fails.
+         */
+        virtual bool NodeToBool(JsonNode node) const = 0;
+
+        /**
+         * @brief Borrow a string value.
+         * @throw XJsonError If the handle is empty or the value is not a string.
+         */
+        virtual std::string_view NodeToStringView(JsonNode node) const = 0;
+
+        /**
+         * @brief Convert a value like `NodeToInt()`, without throwing.
+         * @param node The value; never empty.
+         * @param value Receives the converted value on success.
+         * @return `JsonErrorCode::None` on success, `IncorrectType` if the conversion fails.
+         */
+        virtual JsonErrorCode NodeTryToInt(JsonNode node, int64_t& value) const = 0;
+
+        /**
+         * @brief Convert a value like `NodeToUnsigned()`, without throwing.
+         */
+        virtual JsonErrorCode NodeTryToUnsigned(JsonNode node, uint64_t& value) const = 0;
+
+        /**
+         * @brief Convert a value like `NodeToDouble()`, without throwing.
+         */
+        virtual JsonErrorCode NodeTryToDouble(JsonNode node, double& value) const = 0;
+
+        /**
+         * @brief Convert a value like `NodeToBool()`, without throwing.
+         */
+        virtual JsonErrorCode NodeTryToBool(JsonNode node, bool& value) const = 0;
+
+        /**
+         * @brief Read a string value like `NodeToStringView()`, without throwing.
+         */
+        virtual JsonErrorCode NodeTryToStringView(JsonNode node, std::string_view& value) const = 0;
+
+        /**
+         * @brief Check if a value is null.
+         * @throw XJsonError If the handle is empty.
+         */
+        virtual bool NodeIsNull(JsonNode node) const = 0;
+
+        /**
+         * @brief Check if a value is an object. An empty handle is not.
+         */
+        virtual bool NodeIsObject(JsonNode node) const = 0;
+
+        /**
+         * @brief Check if a value is an array. An empty handle is not.
+         */
+        virtual bool NodeIsArray(JsonNode node) const = 0;
+
+        /**
+         * @brief Number of elements of an array.
+         * @throw XJsonError If the handle is empty or the value is not an array.
+         */
+        virtual std::size_t NodeArraySize(JsonNode node) const = 0;
+
+        /**
+         * @brief Handle of the element `index` of `array`.
+         * @return Empty handle if `array` is empty, not an array or has no such element.
+         */
+        virtual JsonNode ElementNode(JsonNode array, std::size_t index) const = 0;
+
+        /**
+         * @brief Call `visitor` with every member of `object`.
+         * @throw XJsonError If the handle is empty or the value is not an object.
+         */
+        virtual void NodeForEachMember(JsonNode object, IJsonMemberVisitor& visitor) const = 0;
+
+        /**
+         * @brief Convert every element of an array to an integer, in one call.
+         * @return Number of elements written to `values`.
+         * @throw XJsonError If the handle is empty, the value is not an array, an element fails conversion or the
+         *        array has more than `capacity` elements.
+         */
+        virtual std::size_t NodeToIntArray(JsonNode node, int64_t* values, std::size_t capacity) const = 0;
+
+        /**
+         * @brief Convert every element of an array to an unsigned integer, in one call.
+         * @return Number of elements written to `values`.
+         * @throw XJsonError Same as `NodeToIntArray()`.
+         */
+        virtual std::size_t NodeToUnsignedArray(JsonNode node, uint64_t* values, std::size_t capacity) const = 0;
+
+        /**
+         * @brief Convert every element of an array to a double, in one call.
+         * @return Number of elements written to `values`.
+         * @throw XJsonError Same as `NodeToIntArray()`.
+         */
+        virtual std::size_t NodeToDoubleArray(JsonNode node, double* values, std::size_t capacity) const = 0;
+
+        /**
+         * @brief Copy a value into a new wrapper of the same type.
+         * @throw XJsonError If the handle is empty.
+         */
+        virtual std::unique_ptr<IJsonWrapper> NodeToObject(JsonNode node) const = 0;
+
+        /**
+         * @brief Serialize a value, in the same form as `ToString()`.
+         * @throw XJsonError If the handle is empty or serialization fails.
+         */
+        virtual std::string NodeToString(JsonNode node) const = 0;
+
+        /**
+         * @brief Serialize a value to `output`, in the same form as `ToString()`.
+         * @throw XJsonError If the handle is empty or serialization fails.
+         */
+        virtual void NodeSerialize(JsonNode node, Details::JsonOutput& output) const = 0;
+
+        /**
+         * @brief Handle of the value at `path`, walking `MemberNode()` and `ElementNode()` from the root by default.
+         * @return Empty handle if the location doesn't exist.
+         */
+        virtual JsonNode PathNode(const JsonPath& path) const;
+
+        /**
+         * @brief Handles of all the elements of an array, calling `ElementNode()` for each by default.
+         * @throw XJsonError If the handle is empty or not an array.
+         * @note Backends whose `ElementNode()` walks the array from the start override it to walk it once.
+         */
+        virtual std::vector<JsonNode> ElementNodes(JsonNode array) const;
+
+        /**
+         * @brief Serialize a value like `NodeSerialize()`, safely from several threads at once.
+         * @note Defaults to `NodeSerialize()`; backends whose serializer keeps state in the document override it.
+         */
+        virtual void NodeSerializeConcurrent(JsonNode node, Details::JsonOutput& output) const;
+
+        /**
+         * @brief Pass a value to `handler` as events, e.g. for another backend to build its tree from.
+         * @throw XJsonError If the handle is empty, or whatever `handler` throws.
+         * @note Defaults to reading the events back from `NodeSerialize()`; tree backends override it to walk the
+         *       tree instead.
+         */
+        virtual void NodeEmit(JsonNode node, IJsonHandler& handler) const;
+
+        /**
+         * @brief Take the value of a top level key out of the document, for a nested setter to modify and give back
+         *        through `SetObject()`.
+         * @note Defaults to `GetObject()`; tree backends override it to move the subtree instead of copying it.
+         */
+        virtual std::unique_ptr<IJsonWrapper> DetachObject(std::string_view key);
+
+        // #endregion
+
+        // #region Streaming
+
+        /**
+         * @brief Open a cursor that parses the documents of `batch` into this object one at a time, for `JsonStream`.
+         * @note Defaults to splitting the batch on newlines and calling `Parse()` on every non-blank line.
+         */
+        virtual std::unique_ptr<IJsonStreamCursor> OpenStream(std::string_view batch, const JsonStreamOptions& options);
+
+        /**
+         * @brief Open a cursor that parses a document pushed in chunks into this object, for `JsonFeedParser`.
+         * @note Defaults to cutting a root object into its top level members as they complete, each parsed into a
+         *       wrapper from `GetEmptyObject()` and set with `SetObject()`. Other roots are parsed whole by `Finish()`.
+         */
+        virtual std::unique_ptr<IJsonFeedCursor> OpenFeed();
+
+        // #endregion
+
+    private:
+        /**
+         * @brief Apply `setter` to the parent object of the path `[first, last)` and its last key.
+         * @tparam TSetter Callable as `setter(IJsonWrapper& parent, std::string_view key)`.
+         */
+        template<typename TSetter>
+        void SetAtPath(std::vector<std::string>::const_iterator first,
+                       std::vector<std::string>::const_iterator last,
+                       TSetter&& setter);
+
+        /**
+         * @brief Run a `NodeTryTo*()` conversion on `node`, or report `NoSuchKey` if the handle is empty.
+         */
+        template<typename TValue>
+        JsonResult<TValue> TryConvert(JsonNode node,
+                                      JsonErrorCode (IJsonWrapper::*convert)(JsonNode, TValue&) const) const;
     };
 
+    /**
+     * @brief Creates an empty document of some backend, e.g. for the containers that parse on their own.
+     */
+    using JsonWrapperFactory = std::function<std::unique_ptr<IJsonWrapper>()>;
+
 }  // namespace Wrappers
 
 #endif  // _INCLUDE_JSON_WRAPPER_SRC_IJSONWRAPPER_HPP_
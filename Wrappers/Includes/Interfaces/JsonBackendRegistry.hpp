@@ -0,0 +1,173 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_JSONBACKENDREGISTRY_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_JSONBACKENDREGISTRY_HPP_
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Interfaces/IJsonWrapper.hpp"
+
+namespace Wrappers
+{
+    /**
+     * @enum JsonWorkload
+     * @brief What documents are used for, to pick a backend without naming it.
+     */
+    enum class JsonWorkload
+    {
+        /**
+         * @brief No particular profile: "nlohmann", the reference the other backends match.
+         */
+        General,
+
+        /**
+         * @brief Parsed, then read a few keys at a time by one thread and seldom modified: "simdjson", the fastest to
+         *        parse.
+         */
+        ReadMostly,
+
+        /**
+         * @brief Built or edited through the setters: "nlohmann"; the simdjson backend rewrites its text on every set.
+         */
+        WriteHeavy,
+
+        /**
+         * @brief Kept in large numbers: "nlohmann-flat", whose objects hold about a third less than the map.
+         */
+        LowMemory,
+
+        /**
+         * @brief Parsed once and read from several threads at once, e.g. in a `JsonDocumentCache`: "nlohmann".
+         *        Only backends that allow concurrent reads may be preferred for it.
+         */
+        SharedReads
+    };
+
+    /**
+     * @class JsonBackendRegistry
+     * @brief Creates documents of a backend chosen by name or by workload, so that call sites need not name a
+     *        wrapper class.
+     * @note `Instance()` knows the backends of this library as "nlohmann", "nlohmann-flat", "nlohmann-pmr" and
+     *       "simdjson".
+     *       Other backends can be registered next to them, and the backend of a workload changed.
+     * @note Thread-safe. Creating documents only takes a shared lock.
+     * @note Documents of different backends can be mixed: `IJsonWrapper::SetObject()` converts a child of another
+     *       backend without going through text.
+     *
+     * @code
+     * auto& registry = Wrappers::JsonBackendRegistry::Instance();
+     * std::unique_ptr<Wrappers::IJsonWrapper> request = registry.Create(Wrappers::JsonWorkload::ReadMostly);
+     * request->Parse(body);
+     * std::unique_ptr<Wrappers::IJsonWrapper> reply = registry.Create("nlohmann");
+     * reply->SetObject("echo", std::move(request));
+     * @endcode
+     */
+    class JsonBackendRegistry
+    {
+    public:
+        /**
+         * @brief Creates an empty document of a backend.
+         * @param resource Supplies the wrapper and, for backends that take one, its values; `nullptr` for the
+         *        default resource.
+         */
+        using Factory = std::function<std::unique_ptr<IJsonWrapper>(std::pmr::memory_resource* resource)>;
+
+        /**
+         * @brief An empty registry, whose workloads all map to "nlohmann" until changed by `Prefer()`.
+         */
+        JsonBackendRegistry();
+
+        JsonBackendRegistry(const JsonBackendRegistry&) = delete;
+
+        JsonBackendRegistry& operator=(const JsonBackendRegistry&) = delete;
+
+        JsonBackendRegistry(JsonBackendRegistry&&) = delete;
+
+        JsonBackendRegistry& operator=(JsonBackendRegistry&&) = delete;
+
+        /**
+         * @brief The process-wide registry, holding the backends of this library.
+         */
+        static JsonBackendRegistry& Instance();
+
+        /**
+         * @brief Register a backend, replacing any registered under the same name.
+         * @throw XJsonError If `name` or `factory` is empty.
+         */
+        void Register(std::string_view name, Factory factory);
+
+        /**
+         * @brief Choose the backend created for `workload`.
+         * @throw XJsonError If no backend is registered as `name`, or if `workload` is `JsonWorkload::SharedReads`
+         *        and the documents of the backend may not be read from several threads at once.
+         */
+        void Prefer(JsonWorkload workload, std::string_view name);
+
+        /**
+         * @brief Name of the backend created for `workload`.
+         */
+        std::string PreferredName(JsonWorkload workload) const;
+
+        bool Contains(std::string_view name) const;
+
+        /**
+         * @brief Names of the registered backends, sorted.
+         */
+        std::vector<std::string> Names() const;
+
+        /**
+         * @brief Create an empty document of the backend registered as `name`.
+         * @throw XJsonError If no backend is registered as `name`.
+         */
+        std::unique_ptr<IJsonWrapper> Create(std::string_view name,
+                                             std::pmr::memory_resource* resource = nullptr) const;
+
+        /**
+         * @brief Create an empty document of the backend chosen for `workload`.
+         * @throw XJsonError If that backend is not registered.
+         */
+        std::unique_ptr<IJsonWrapper> Create(JsonWorkload workload,
+                                             std::pmr::memory_resource* resource = nullptr) const;
+
+        /**
+         * @brief A factory of the backend registered as `name`, e.g. for `ParseBatch()`, or for a `JsonDocumentCache`
+         *        if the backend allows concurrent reads (`JsonWorkload::SharedReads` always does).
+         * @throw XJsonError If no backend is registered as `name`.
+         * @note The backend is looked up once; later registrations don't affect the factory.
+         */
+        JsonWrapperFactory MakeFactory(std::string_view name, std::pmr::memory_resource* resource = nullptr) const;
+
+        /**
+         * @brief A factory of the backend chosen for `workload`, looked up once like the overload above.
+         */
+        JsonWrapperFactory MakeFactory(JsonWorkload workload, std::pmr::memory_resource* resource = nullptr) const;
+
+    private:
+        /**
+         * @brief The factory registered as `name`, with `_mutex` held.
+         * @throw XJsonError If there is none.
+         */
+        const Factory& Find(std::string_view name) const;
+
+        static constexpr std::size_t kWorkloadCount = 5;
+
+        mutable std::shared_mutex _mutex;
+
+        std::map<std::string, Factory, std::less<>> _factories;
+
+        /**
+         * @brief Backend name per workload, indexed by `JsonWorkload`.
+         */
+        std::array<std::string, kWorkloadCount> _preferred;
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_JSONBACKENDREGISTRY_HPP_
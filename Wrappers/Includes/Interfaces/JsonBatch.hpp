@@ -0,0 +1,57 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_JSONBATCH_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_JSONBATCH_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "Interfaces/IJsonWrapper.hpp"
+
+namespace Wrappers
+{
+    /**
+     * @struct JsonBatchOptions
+     * @brief Parallelism of `Wrappers::ParseBatch()`.
+     */
+    struct JsonBatchOptions
+    {
+        /**
+         * @brief Threads parsing, the calling one included; 0 for one per hardware thread.
+         */
+        std::size_t threadCount{0};
+
+        /**
+         * @brief Documents a thread takes at once. Larger chunks mean less contention, smaller ones a better balance
+         *        when document sizes vary.
+         */
+        std::size_t chunkSize{16};
+    };
+
+    /**
+     * @brief Parse many documents in parallel, each into a document of its own.
+     * @param factory Creates the documents to parse into; called from several threads at once.
+     * @param documents The texts to parse. They are not referenced after the call returns.
+     * @param count Number of texts.
+     * @param options Parallelism.
+     * @return The documents, in the order of their texts.
+     * @throw XJsonError If a text fails to parse; the message names its index. The remaining texts are skipped.
+     * @note Threads take chunks of consecutive texts from a shared counter until none is left, so a thread that
+     *       drew small documents goes on with the next chunk instead of idling. The threads are kept for the next
+     *       batch.
+     * @note `factory` is called once per text: the documents are returned, and a document keeps its parser and
+     *       whatever it parsed into, so a parser can't be shared by the documents of a thread.
+     *
+     * @code
+     * const std::vector<std::unique_ptr<Wrappers::IJsonWrapper>> records = Wrappers::ParseBatch(
+     *     [] { return std::make_unique<Wrappers::SimdJsonWrapper>(); }, lines.data(), lines.size());
+     * @endcode
+     */
+    std::vector<std::unique_ptr<IJsonWrapper>> ParseBatch(const JsonWrapperFactory& factory,
+                                                          const std::string_view* documents,
+                                                          std::size_t count,
+                                                          const JsonBatchOptions& options = {});
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_JSONBATCH_HPP_
@@ -0,0 +1,25 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_JSONBINARYFORMAT_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_JSONBINARYFORMAT_HPP_
+
+namespace Wrappers
+{
+    /**
+     * @enum JsonBinaryFormat
+     * @brief Binary encodings of a document, for `IJsonWrapper::ToBinary()` and `IJsonWrapper::ParseBinary()`.
+     */
+    enum class JsonBinaryFormat
+    {
+        /**
+         * @brief Concise Binary Object Representation (RFC 8949).
+         */
+        Cbor,
+
+        /**
+         * @brief MessagePack (https://msgpack.org).
+         */
+        MessagePack
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_JSONBINARYFORMAT_HPP_
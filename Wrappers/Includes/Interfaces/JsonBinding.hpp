@@ -0,0 +1,454 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_JSONBINDING_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_JSONBINDING_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Exceptions/XJsonError.hpp"
+#include "Interfaces/IJsonWrapper.hpp"
+#include "Interfaces/JsonView.hpp"
+
+namespace Wrappers
+{
+    /**
+     * @struct JsonField
+     * @brief One entry of a `JsonBinding` field table: a key and the member it maps to.
+     */
+    template<typename TStruct, typename TMember>
+    struct JsonField
+    {
+        std::string_view name;
+        TMember TStruct::*member;
+    };
+
+    /**
+     * @brief Make a `JsonField`, deducing its types from the member pointer.
+     */
+    template<typename TStruct, typename TMember>
+    constexpr JsonField<TStruct, TMember> Field(std::string_view name, TMember TStruct::*member)
+    {
+        return JsonField<TStruct, TMember>{name, member};
+    }
+
+    /**
+     * @struct JsonBinding
+     * @brief Field table of a struct, declared by specializing this template with a `static constexpr` tuple of
+     *        `Field()`s named `fields`.
+     * @note Supported members: `bool`, integers (range checked), floating point numbers, `std::string`,
+     *       `std::optional` of a supported type (null when empty), `std::vector` of a supported type and structs that
+     *       have a binding themselves. Vectors of `bool` and of structs are decoded but not encoded.
+     *
+     * @code
+     * struct Order
+     * {
+     *     int64_t id;
+     *     std::string sku;
+     *     std::vector<double> prices;
+     *     std::optional<Customer> customer;
+     * };
+     *
+     * template<>
+     * struct Wrappers::JsonBinding<Order>
+     * {
+     *     static constexpr auto fields = std::make_tuple(Wrappers::Field("id", &Order::id),
+     *                                                    Wrappers::Field("sku", &Order::sku),
+     *                                                    Wrappers::Field("prices", &Order::prices),
+     *                                                    Wrappers::Field("customer", &Order::customer));
+     * };
+     *
+     * jsonWrapper.Parse(body);
+     * Order order;
+     * Wrappers::DecodeStruct(jsonWrapper, order);
+     * @endcode
+     */
+    template<typename TStruct>
+    struct JsonBinding;
+
+    template<typename TStruct>
+    void DecodeStruct(const JsonView& object, TStruct& value);
+
+    template<typename TStruct>
+    void EncodeStruct(const TStruct& value, IJsonWrapper& document);
+
+    namespace Details
+    {
+        template<typename TValue, typename = void>
+        struct IsBound : std::false_type
+        {
+        };
+
+        template<typename TValue>
+        struct IsBound<TValue, std::void_t<decltype(JsonBinding<TValue>::fields)>> : std::true_type
+        {
+        };
+
+        template<typename TValue>
+        struct IsOptional : std::false_type
+        {
+        };
+
+        template<typename TValue>
+        struct IsOptional<std::optional<TValue>> : std::true_type
+        {
+        };
+
+        template<typename TValue>
+        struct IsVector : std::false_type
+        {
+        };
+
+        template<typename TValue>
+        struct IsVector<std::vector<TValue>> : std::true_type
+        {
+        };
+
+        template<typename TValue>
+        constexpr bool kIsSignedInteger = std::is_integral_v<TValue> && std::is_signed_v<TValue>;
+
+        template<typename TValue>
+        constexpr bool kIsUnsignedInteger =
+            std::is_integral_v<TValue> && !std::is_signed_v<TValue> && !std::is_same_v<TValue, bool>;
+
+        /**
+         * @brief Convert a decoded integer to the type of the member.
+         * @throw XJsonError If the value doesn't fit.
+         */
+        template<typename TInteger, typename TWide>
+        TInteger Narrow(TWide value)
+        {
+            if constexpr (std::is_same_v<TInteger, TWide>)
+            {
+                return value;
+            }
+            else
+            {
+                if (value < std::numeric_limits<TInteger>::min() || value > std::numeric_limits<TInteger>::max())
+                {
+                    throw XJsonError{"Integer value out of range."};
+                }
+
+                return static_cast<TInteger>(value);
+            }
+        }
+
+        template<typename TValue>
+        void DecodeValue(const JsonView& view, TValue& value);
+
+        /**
+         * @brief Read an array; numbers are converted in one pass by the backend.
+         */
+        template<typename TElement>
+        void DecodeArray(const JsonView& view, std::vector<TElement>& values)
+        {
+            if constexpr (std::is_same_v<TElement, int64_t>)
+            {
+                view.AsIntArray(values);
+            }
+            else if constexpr (std::is_same_v<TElement, uint64_t>)
+            {
+                view.AsUnsignedArray(values);
+            }
+            else if constexpr (std::is_same_v<TElement, double>)
+            {
+                view.AsDoubleArray(values);
+            }
+            else if constexpr (kIsSignedInteger<TElement> || kIsUnsignedInteger<TElement>)
+            {
+                using TWide = std::conditional_t<kIsSignedInteger<TElement>, int64_t, uint64_t>;
+
+                std::vector<TWide> wide;
+                DecodeArray(view, wide);
+
+                values.clear();
+                values.reserve(wide.size());
+                for (const TWide element : wide)
+                {
+                    values.push_back(Narrow<TElement>(element));
+                }
+            }
+            else
+            {
+                // the handles are taken in one pass, so elements holding arrays don't make the backend walk this one
+                // again
+                const std::vector<JsonView> elements = view.Elements();
+
+                values.clear();
+                values.reserve(elements.size());
+                for (const JsonView& elementView : elements)
+                {
+                    TElement element{};
+                    DecodeValue(elementView, element);
+                    values.push_back(std::move(element));
+                }
+            }
+        }
+
+        /**
+         * @brief Read one member value into `value`.
+         * @throw XJsonError If the value doesn't have the type of the member.
+         */
+        template<typename TValue>
+        void DecodeValue(const JsonView& view, TValue& value)
+        {
+            if constexpr (std::is_same_v<TValue, bool>)
+            {
+                value = view.AsBool();
+            }
+            else if constexpr (kIsSignedInteger<TValue>)
+            {
+                value = Narrow<TValue>(view.AsInt());
+            }
+            else if constexpr (kIsUnsignedInteger<TValue>)
+            {
+                value = Narrow<TValue>(view.AsUnsigned());
+            }
+            else if constexpr (std::is_same_v<TValue, double>)
+            {
+                value = view.AsDouble();
+            }
+            else if constexpr (std::is_floating_point_v<TValue>)
+            {
+                value = static_cast<TValue>(view.AsDouble());
+            }
+            else if constexpr (std::is_same_v<TValue, std::string>)
+            {
+                value.assign(view.AsStringView());
+            }
+            else if constexpr (IsOptional<TValue>::value)
+            {
+                if (view.IsNull())
+                {
+                    value.reset();
+                }
+                else
+                {
+                    DecodeValue(view, value.emplace());
+                }
+            }
+            else if constexpr (IsVector<TValue>::value)
+            {
+                DecodeArray(view, value);
+            }
+            else
+            {
+                static_assert(IsBound<TValue>::value, "the member type is not supported and has no JsonBinding");
+                DecodeStruct(view, value);
+            }
+        }
+
+        /**
+         * @brief Decodes the members of one object into a struct as the backend walks them.
+         */
+        template<typename TStruct>
+        class StructDecoder final : public IJsonMemberVisitor
+        {
+        public:
+            explicit StructDecoder(TStruct& value) : _value{value}
+            {
+            }
+
+            void Visit(std::string_view key, const JsonView& value) override
+            {
+                const std::size_t index = FindField(key);
+                if (kFieldCount != index)
+                {
+                    DecodeField(index, value, std::make_index_sequence<kFieldCount>{});
+                }
+            }
+
+        private:
+            static constexpr std::size_t kFieldCount =
+                std::tuple_size_v<std::decay_t<decltype(JsonBinding<TStruct>::fields)>>;
+
+            template<std::size_t... VIndices>
+            static constexpr std::array<std::string_view, kFieldCount> Names(std::index_sequence<VIndices...>)
+            {
+                return {{std::get<VIndices>(JsonBinding<TStruct>::fields).name...}};
+            }
+
+            static constexpr std::array<std::string_view, kFieldCount> kNames =
+                Names(std::make_index_sequence<kFieldCount>{});
+
+            /**
+             * @brief Index of the field named `key`, `kFieldCount` if there is none.
+             * @note Documents usually list members in declaration order, so the search starts after the last match
+             *       and a whole document is matched in about one comparison per member.
+             */
+            std::size_t FindField(std::string_view key)
+            {
+                for (std::size_t offset = 0; offset < kFieldCount; ++offset)
+                {
+                    const std::size_t index = (_next + offset) % kFieldCount;
+                    if (kNames[index] == key)
+                    {
+                        _next = index + 1;
+                        return index;
+                    }
+                }
+
+                return kFieldCount;
+            }
+
+            template<std::size_t VIndex>
+            void DecodeField(const JsonView& view)
+            {
+                DecodeValue(view, _value.*(std::get<VIndex>(JsonBinding<TStruct>::fields).member));
+            }
+
+            template<std::size_t... VIndices>
+            void DecodeField(std::size_t index, const JsonView& view, std::index_sequence<VIndices...>)
+            {
+                ((VIndices == index ? DecodeField<VIndices>(view) : void()), ...);
+            }
+
+            TStruct& _value;
+
+            /**
+             * @brief Where the next key is expected in the field table.
+             */
+            std::size_t _next{0};
+        };
+
+        template<typename TElement>
+        inline constexpr bool kAlwaysFalse = false;
+
+        /**
+         * @brief Write one member value under `key`.
+         */
+        template<typename TValue>
+        void EncodeValue(IJsonWrapper& document, std::string_view key, const TValue& value)
+        {
+            if constexpr (std::is_same_v<TValue, bool>)
+            {
+                document.SetBool(key, value);
+            }
+            else if constexpr (kIsSignedInteger<TValue>)
+            {
+                const int64_t wide = value;
+                document.SetInt(key, wide);
+            }
+            else if constexpr (kIsUnsignedInteger<TValue>)
+            {
+                const uint64_t wide = value;
+                document.SetUnsigned(key, wide);
+            }
+            else if constexpr (std::is_same_v<TValue, double>)
+            {
+                document.SetDouble(key, value);
+            }
+            else if constexpr (std::is_floating_point_v<TValue>)
+            {
+                document.SetDouble(key, static_cast<double>(value));
+            }
+            else if constexpr (std::is_same_v<TValue, std::string>)
+            {
+                document.SetString(key, value);
+            }
+            else if constexpr (IsOptional<TValue>::value)
+            {
+                if (value.has_value())
+                {
+                    EncodeValue(document, key, *value);
+                }
+                else
+                {
+                    document.SetNull(key);
+                }
+            }
+            else if constexpr (IsVector<TValue>::value)
+            {
+                using TElement = typename TValue::value_type;
+
+                if constexpr (std::is_same_v<TElement, int64_t>)
+                {
+                    document.SetIntArray(key, value.data(), value.size());
+                }
+                else if constexpr (std::is_same_v<TElement, uint64_t>)
+                {
+                    document.SetUnsignedArray(key, value.data(), value.size());
+                }
+                else if constexpr (std::is_same_v<TElement, double>)
+                {
+                    document.SetDoubleArray(key, value.data(), value.size());
+                }
+                else if constexpr (kIsSignedInteger<TElement> || kIsUnsignedInteger<TElement> ||
+                                   std::is_floating_point_v<TElement>)
+                {
+                    using TInteger = std::conditional_t<kIsSignedInteger<TElement>, int64_t, uint64_t>;
+                    using TWide = std::conditional_t<std::is_floating_point_v<TElement>, double, TInteger>;
+
+                    const std::vector<TWide> wide(value.begin(), value.end());
+                    EncodeValue(document, key, wide);
+                }
+                else if constexpr (std::is_same_v<TElement, std::string>)
+                {
+                    const std::vector<std::string_view> views(value.begin(), value.end());
+                    document.SetStringArray(key, views.data(), views.size());
+                }
+                else
+                {
+                    static_assert(kAlwaysFalse<TElement>, "only vectors of numbers and strings can be encoded");
+                }
+            }
+            else
+            {
+                static_assert(IsBound<TValue>::value, "the member type is not supported and has no JsonBinding");
+
+                std::unique_ptr<IJsonWrapper> object = document.GetEmptyObject();
+                EncodeStruct(value, *object);
+                document.SetObject(key, std::move(object));
+            }
+        }
+
+    }  // namespace Details
+
+    /**
+     * @brief Decode an object into a struct in one pass over its members.
+     * @param object The object to decode.
+     * @param value Receives the members named in its `JsonBinding`. Members missing from the object keep their
+     *        value; keys without a field are ignored.
+     * @throw XJsonError If the viewed value is not an object or a member doesn't have the type of its field.
+     */
+    template<typename TStruct>
+    void DecodeStruct(const JsonView& object, TStruct& value)
+    {
+        Details::StructDecoder<TStruct> decoder{value};
+        object.ForEachMember(decoder);
+    }
+
+    /**
+     * @brief Decode the whole document into a struct.
+     */
+    template<typename TStruct>
+    void DecodeStruct(const IJsonWrapper& document, TStruct& value)
+    {
+        DecodeStruct(document.View(), value);
+    }
+
+    /**
+     * @brief Write every field of a struct into `document`, through the setters of its backend.
+     * @param value The struct to encode. Empty `std::optional` fields become null.
+     * @param document Receives one member per field; other members are left untouched.
+     */
+    template<typename TStruct>
+    void EncodeStruct(const TStruct& value, IJsonWrapper& document)
+    {
+        const auto encode = [&value, &document](const auto&... field) {
+            (Details::EncodeValue(document, field.name, value.*(field.member)), ...);
+        };
+        std::apply(encode, JsonBinding<TStruct>::fields);
+    }
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_JSONBINDING_HPP_
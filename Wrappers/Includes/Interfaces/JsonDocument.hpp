@@ -0,0 +1,594 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_JSONDOCUMENT_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_JSONDOCUMENT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "Exceptions/XJsonError.hpp"
+#include "Interfaces/IJsonSink.hpp"
+#include "Interfaces/IJsonWrapper.hpp"
+#include "Interfaces/JsonBinaryFormat.hpp"
+#include "Interfaces/JsonKey.hpp"
+#include "Interfaces/JsonPath.hpp"
+#include "Interfaces/JsonResult.hpp"
+#include "Interfaces/JsonView.hpp"
+
+namespace Wrappers
+{
+    /**
+     * @class JsonDocument
+     * @brief The `IJsonWrapper` API bound to one backend at compile time.
+     * @tparam TBackend An implementation of `IJsonWrapper`, e.g. `Wrappers::SimdJsonWrapper`. It need not be `final`:
+     *         the document holds exactly a `TBackend`, never a subclass of it.
+     * @note Every call is qualified with the backend type, so it is dispatched statically instead of through the
+     *       vtable. The backends are compiled into the library, so the calls are inlined only when the library and
+     *       the caller are built with link-time optimization (`ENABLE_IPO`); otherwise each is a direct call.
+     * @note The backend is allocated on the heap once per document, because backends need not be movable.
+     * @note `SetObject()` by key, by `JsonKey` or by a path of one segment takes a document of the same backend and
+     *       skips the type check of `IJsonWrapper::SetObject()`. Deeper paths set the objects along the way through
+     *       `IJsonWrapper`, and keep the check.
+     * @note `Wrapper()` exposes the document as an `IJsonWrapper` for code that needs runtime polymorphism.
+     * @note Move-only. A moved-from document may only be assigned to or destroyed.
+     *
+     * @code
+     * Wrappers::JsonDocument<Wrappers::SimdJsonWrapper> document;
+     * document.Parse(body);
+     * for (const std::string_view key : keys)
+     * {
+     *     total += document.GetInt(key);
+     * }
+     * @endcode
+     */
+    template<typename TBackend>
+    class JsonDocument
+    {
+        static_assert(std::is_base_of_v<IJsonWrapper, TBackend>, "the backend must implement IJsonWrapper");
+
+    public:
+        /**
+         * @brief Create a null JSON value with a default-constructed backend.
+         */
+        JsonDocument() : _backend{std::make_unique<TBackend>()}
+        {
+        }
+
+        /**
+         * @brief Adopt a backend, e.g. one allocated from a memory resource.
+         * @throw XJsonError If `backend` is empty, or a subclass of `TBackend` whose overrides the calls would skip.
+         */
+        explicit JsonDocument(std::unique_ptr<TBackend> backend) : _backend{std::move(backend)}
+        {
+            if (nullptr == _backend || typeid(*_backend) != typeid(TBackend))
+            {
+                throw XJsonError{"Invalid JSON backend."};
+            }
+        }
+
+        // #region Adapter
+
+        /**
+         * @brief The document as an `IJsonWrapper`, e.g. to pass it to code written against the interface.
+         */
+        IJsonWrapper& Wrapper()
+        {
+            return *_backend;
+        }
+
+        const IJsonWrapper& Wrapper() const
+        {
+            return *_backend;
+        }
+
+        /**
+         * @brief The backend itself, for its own extensions.
+         */
+        TBackend& Backend()
+        {
+            return *_backend;
+        }
+
+        const TBackend& Backend() const
+        {
+            return *_backend;
+        }
+
+        /**
+         * @brief Hand the backend over, e.g. to `IJsonWrapper::SetObject()`. The document is left moved-from.
+         */
+        std::unique_ptr<IJsonWrapper> ReleaseWrapper()
+        {
+            return std::move(_backend);
+        }
+
+        // #endregion
+
+        // #region Setters
+
+        void SetInt(std::string_view key, int64_t value)
+        {
+            _backend->TBackend::SetInt(key, value);
+        }
+
+        void SetUnsigned(std::string_view key, uint64_t value)
+        {
+            _backend->TBackend::SetUnsigned(key, value);
+        }
+
+        void SetDouble(std::string_view key, double value)
+        {
+            _backend->TBackend::SetDouble(key, value);
+        }
+
+        void SetBool(std::string_view key, bool value)
+        {
+            _backend->TBackend::SetBool(key, value);
+        }
+
+        void SetString(std::string_view key, std::string_view value)
+        {
+            _backend->TBackend::SetString(key, value);
+        }
+
+        /**
+         * @brief Set an inner object. `jsonObject` is consumed; its tree is moved rather than copied where the
+         *        backend allows it.
+         */
+        void SetObject(std::string_view key, JsonDocument jsonObject)
+        {
+            _backend->TBackend::SetObject(key, std::move(jsonObject._backend));
+        }
+
+        void SetNull(std::string_view key)
+        {
+            _backend->TBackend::SetNull(key);
+        }
+
+        void SetIntArray(std::string_view key, const int64_t* values, std::size_t count)
+        {
+            _backend->TBackend::SetIntArray(key, values, count);
+        }
+
+        void SetUnsignedArray(std::string_view key, const uint64_t* values, std::size_t count)
+        {
+            _backend->TBackend::SetUnsignedArray(key, values, count);
+        }
+
+        void SetDoubleArray(std::string_view key, const double* values, std::size_t count)
+        {
+            _backend->TBackend::SetDoubleArray(key, values, count);
+        }
+
+        void SetStringArray(std::string_view key, const std::string_view* values, std::size_t count)
+        {
+            _backend->TBackend::SetStringArray(key, values, count);
+        }
+
+        // #endregion
+
+        // #region Getters
+
+        int64_t GetInt(std::string_view key) const
+        {
+            return _backend->TBackend::GetInt(key);
+        }
+
+        uint64_t GetUnsigned(std::string_view key) const
+        {
+            return _backend->TBackend::GetUnsigned(key);
+        }
+
+        double GetDouble(std::string_view key) const
+        {
+            return _backend->TBackend::GetDouble(key);
+        }
+
+        bool GetBool(std::string_view key) const
+        {
+            return _backend->TBackend::GetBool(key);
+        }
+
+        std::string GetString(std::string_view key) const
+        {
+            return _backend->TBackend::GetString(key);
+        }
+
+        std::string_view GetStringView(std::string_view key) const
+        {
+            return _backend->TBackend::GetStringView(key);
+        }
+
+        JsonDocument GetObject(std::string_view key) const
+        {
+            return Adopt(_backend->TBackend::GetObject(key));
+        }
+
+        JsonView GetObjectView(std::string_view key) const
+        {
+            return _backend->TBackend::GetObjectView(key);
+        }
+
+        JsonView View() const
+        {
+            return _backend->TBackend::View();
+        }
+
+        JsonView GetArrayView(std::string_view key) const
+        {
+            return _backend->TBackend::GetArrayView(key);
+        }
+
+        std::size_t GetArraySize(std::string_view key) const
+        {
+            return _backend->TBackend::GetArraySize(key);
+        }
+
+        void GetIntArray(std::string_view key, std::vector<int64_t>& values) const
+        {
+            _backend->TBackend::GetIntArray(key, values);
+        }
+
+        std::size_t GetIntArray(std::string_view key, int64_t* values, std::size_t capacity) const
+        {
+            return _backend->TBackend::GetIntArray(key, values, capacity);
+        }
+
+        void GetUnsignedArray(std::string_view key, std::vector<uint64_t>& values) const
+        {
+            _backend->TBackend::GetUnsignedArray(key, values);
+        }
+
+        std::size_t GetUnsignedArray(std::string_view key, uint64_t* values, std::size_t capacity) const
+        {
+            return _backend->TBackend::GetUnsignedArray(key, values, capacity);
+        }
+
+        void GetDoubleArray(std::string_view key, std::vector<double>& values) const
+        {
+            _backend->TBackend::GetDoubleArray(key, values);
+        }
+
+        std::size_t GetDoubleArray(std::string_view key, double* values, std::size_t capacity) const
+        {
+            return _backend->TBackend::GetDoubleArray(key, values, capacity);
+        }
+
+        bool IsNull(std::string_view key) const
+        {
+            return _backend->TBackend::IsNull(key);
+        }
+
+        bool HasKey(std::string_view key) const
+        {
+            return _backend->TBackend::HasKey(key);
+        }
+
+        JsonDocument GetEmptyObject() const
+        {
+            return Adopt(_backend->TBackend::GetEmptyObject());
+        }
+
+        // #endregion
+
+        // #region Path_Access
+
+        void SetInt(const JsonPath& path, int64_t value)
+        {
+            _backend->TBackend::SetInt(path, value);
+        }
+
+        void SetUnsigned(const JsonPath& path, uint64_t value)
+        {
+            _backend->TBackend::SetUnsigned(path, value);
+        }
+
+        void SetDouble(const JsonPath& path, double value)
+        {
+            _backend->TBackend::SetDouble(path, value);
+        }
+
+        void SetBool(const JsonPath& path, bool value)
+        {
+            _backend->TBackend::SetBool(path, value);
+        }
+
+        void SetString(const JsonPath& path, std::string_view value)
+        {
+            _backend->TBackend::SetString(path, value);
+        }
+
+        void SetObject(const JsonPath& path, JsonDocument jsonObject)
+        {
+            if (1 == path.Segments().size())
+            {
+                _backend->TBackend::SetObject(path.Segments().front(), std::move(jsonObject._backend));
+                return;
+            }
+
+            _backend->TBackend::SetObject(path, std::unique_ptr<IJsonWrapper>{std::move(jsonObject._backend)});
+        }
+
+        void SetNull(const JsonPath& path)
+        {
+            _backend->TBackend::SetNull(path);
+        }
+
+        int64_t GetInt(const JsonPath& path) const
+        {
+            return _backend->TBackend::GetInt(path);
+        }
+
+        uint64_t GetUnsigned(const JsonPath& path) const
+        {
+            return _backend->TBackend::GetUnsigned(path);
+        }
+
+        double GetDouble(const JsonPath& path) const
+        {
+            return _backend->TBackend::GetDouble(path);
+        }
+
+        bool GetBool(const JsonPath& path) const
+        {
+            return _backend->TBackend::GetBool(path);
+        }
+
+        std::string GetString(const JsonPath& path) const
+        {
+            return _backend->TBackend::GetString(path);
+        }
+
+        std::string_view GetStringView(const JsonPath& path) const
+        {
+            return _backend->TBackend::GetStringView(path);
+        }
+
+        JsonView GetObjectView(const JsonPath& path) const
+        {
+            return _backend->TBackend::GetObjectView(path);
+        }
+
+        JsonView GetArrayView(const JsonPath& path) const
+        {
+            return _backend->TBackend::GetArrayView(path);
+        }
+
+        bool IsNull(const JsonPath& path) const
+        {
+            return _backend->TBackend::IsNull(path);
+        }
+
+        bool HasKey(const JsonPath& path) const
+        {
+            return _backend->TBackend::HasKey(path);
+        }
+
+        // #endregion
+
+        // #region Key_Access
+
+        void SetInt(const JsonKey& key, int64_t value)
+        {
+            _backend->TBackend::SetInt(key, value);
+        }
+
+        void SetUnsigned(const JsonKey& key, uint64_t value)
+        {
+            _backend->TBackend::SetUnsigned(key, value);
+        }
+
+        void SetDouble(const JsonKey& key, double value)
+        {
+            _backend->TBackend::SetDouble(key, value);
+        }
+
+        void SetBool(const JsonKey& key, bool value)
+        {
+            _backend->TBackend::SetBool(key, value);
+        }
+
+        void SetString(const JsonKey& key, std::string_view value)
+        {
+            _backend->TBackend::SetString(key, value);
+        }
+
+        void SetObject(const JsonKey& key, JsonDocument jsonObject)
+        {
+            _backend->TBackend::SetObject(key.Name(), std::move(jsonObject._backend));
+        }
+
+        void SetNull(const JsonKey& key)
+        {
+            _backend->TBackend::SetNull(key);
+        }
+
+        int64_t GetInt(const JsonKey& key) const
+        {
+            return _backend->TBackend::GetInt(key);
+        }
+
+        uint64_t GetUnsigned(const JsonKey& key) const
+        {
+            return _backend->TBackend::GetUnsigned(key);
+        }
+
+        double GetDouble(const JsonKey& key) const
+        {
+            return _backend->TBackend::GetDouble(key);
+        }
+
+        bool GetBool(const JsonKey& key) const
+        {
+            return _backend->TBackend::GetBool(key);
+        }
+
+        std::string GetString(const JsonKey& key) const
+        {
+            return _backend->TBackend::GetString(key);
+        }
+
+        std::string_view GetStringView(const JsonKey& key) const
+        {
+            return _backend->TBackend::GetStringView(key);
+        }
+
+        bool IsNull(const JsonKey& key) const
+        {
+            return _backend->TBackend::IsNull(key);
+        }
+
+        bool HasKey(const JsonKey& key) const
+        {
+            return _backend->TBackend::HasKey(key);
+        }
+
+        // #endregion
+
+        // #region Try_Getters
+
+        JsonResult<int64_t> TryGetInt(std::string_view key) const
+        {
+            return _backend->TBackend::TryGetInt(key);
+        }
+
+        JsonResult<uint64_t> TryGetUnsigned(std::string_view key) const
+        {
+            return _backend->TBackend::TryGetUnsigned(key);
+        }
+
+        JsonResult<double> TryGetDouble(std::string_view key) const
+        {
+            return _backend->TBackend::TryGetDouble(key);
+        }
+
+        JsonResult<bool> TryGetBool(std::string_view key) const
+        {
+            return _backend->TBackend::TryGetBool(key);
+        }
+
+        JsonResult<std::string> TryGetString(std::string_view key) const
+        {
+            return _backend->TBackend::TryGetString(key);
+        }
+
+        JsonResult<std::string_view> TryGetStringView(std::string_view key) const
+        {
+            return _backend->TBackend::TryGetStringView(key);
+        }
+
+        JsonResult<int64_t> TryGetInt(const JsonPath& path) const
+        {
+            return _backend->TBackend::TryGetInt(path);
+        }
+
+        JsonResult<uint64_t> TryGetUnsigned(const JsonPath& path) const
+        {
+            return _backend->TBackend::TryGetUnsigned(path);
+        }
+
+        JsonResult<double> TryGetDouble(const JsonPath& path) const
+        {
+            return _backend->TBackend::TryGetDouble(path);
+        }
+
+        JsonResult<bool> TryGetBool(const JsonPath& path) const
+        {
+            return _backend->TBackend::TryGetBool(path);
+        }
+
+        JsonResult<std::string> TryGetString(const JsonPath& path) const
+        {
+            return _backend->TBackend::TryGetString(path);
+        }
+
+        JsonResult<std::string_view> TryGetStringView(const JsonPath& path) const
+        {
+            return _backend->TBackend::TryGetStringView(path);
+        }
+
+        // #endregion
+
+        // #region Seraialization_Deserialization
+
+        void Parse(std::string_view jsonString)
+        {
+            _backend->TBackend::Parse(jsonString);
+        }
+
+        void Parse(const char* jsonString, std::size_t length)
+        {
+            _backend->TBackend::Parse(jsonString, length);
+        }
+
+        void ParseLazy(std::string_view jsonString)
+        {
+            _backend->TBackend::ParseLazy(jsonString);
+        }
+
+        void ParseFile(const std::string& filePath)
+        {
+            _backend->TBackend::ParseFile(filePath);
+        }
+
+        std::string ToString() const
+        {
+            return _backend->TBackend::ToString();
+        }
+
+        void SerializeTo(std::string& output) const
+        {
+            _backend->TBackend::SerializeTo(output);
+        }
+
+        std::size_t SerializeTo(char* buffer, std::size_t capacity) const
+        {
+            return _backend->TBackend::SerializeTo(buffer, capacity);
+        }
+
+        std::size_t SerializeTo(IJsonSink& sink) const
+        {
+            return _backend->TBackend::SerializeTo(sink);
+        }
+
+        std::vector<std::uint8_t> ToBinary(JsonBinaryFormat format) const
+        {
+            return _backend->TBackend::ToBinary(format);
+        }
+
+        void ParseBinary(JsonBinaryFormat format, const std::uint8_t* bytes, std::size_t size)
+        {
+            _backend->TBackend::ParseBinary(format, bytes, size);
+        }
+
+        // #endregion
+
+    private:
+        /**
+         * @brief Wrap an object created by the backend. Backends create objects of their own type, not of subclasses.
+         * @throw XJsonError If `wrapper` is not exactly a `TBackend`.
+         */
+        static JsonDocument Adopt(std::unique_ptr<IJsonWrapper> wrapper)
+        {
+            if (nullptr == wrapper || typeid(*wrapper) != typeid(TBackend))
+            {
+                throw XJsonError{"Invalid JSON backend."};
+            }
+
+            return JsonDocument{std::unique_ptr<TBackend>{static_cast<TBackend*>(wrapper.release())}};
+        }
+
+        /**
+         * @brief The backend, held through a pointer because backends are neither copyable nor movable.
+         */
+        std::unique_ptr<TBackend> _backend;
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_JSONDOCUMENT_HPP_
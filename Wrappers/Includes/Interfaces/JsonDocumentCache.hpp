@@ -0,0 +1,120 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_JSONDOCUMENTCACHE_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_JSONDOCUMENTCACHE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "Interfaces/IJsonWrapper.hpp"
+
+namespace Wrappers
+{
+    /**
+     * @struct JsonCacheOptions
+     * @brief Sizing of a `Wrappers::JsonDocumentCache`.
+     */
+    struct JsonCacheOptions
+    {
+        /**
+         * @brief Documents kept at most, spread evenly over the shards.
+         */
+        std::size_t capacity{1024};
+
+        /**
+         * @brief Independently locked parts of the cache; more shards mean less contention between threads.
+         */
+        std::size_t shardCount{16};
+    };
+
+    /**
+     * @struct JsonCacheStatistics
+     * @brief Counters of a `Wrappers::JsonDocumentCache` since its construction.
+     */
+    struct JsonCacheStatistics
+    {
+        uint64_t hits{0};
+
+        uint64_t misses{0};
+
+        uint64_t evictions{0};
+    };
+
+    /**
+     * @class JsonDocumentCache
+     * @brief Thread-safe LRU cache of parsed documents, keyed by the bytes they were parsed from.
+     * @note The input is hashed and looked up in one of several shards, each with its own lock and LRU order, so
+     *       threads contend only when they hit the same shard. Equal hashes are confirmed by comparing the text.
+     * @note Parsing happens outside the lock. Threads that miss the same text at the same time may each parse it;
+     *       the first document stored is handed to all of them.
+     * @note Documents are shared and must not be modified. Evicted documents stay valid while a handle is held.
+     * @note Documents are read from several threads at once, so the backend must allow it
+     *       (`IJsonWrapper::AllowsConcurrentReads()`): the nlohmann one does, the simdjson one doesn't.
+     *
+     * @code
+     * Wrappers::JsonDocumentCache cache{[] { return std::make_unique<Wrappers::NlohmannJsonWrapper>(); }};
+     * const std::shared_ptr<const Wrappers::IJsonWrapper> config = cache.Parse(configText);
+     * Apply(config->GetInt("timeout"));
+     * @endcode
+     */
+    class JsonDocumentCache
+    {
+    public:
+        /**
+         * @param factory Creates the documents to parse into; called from the threads that miss, and once here to
+         *        check the backend.
+         * @throw XJsonError If `factory` is empty, creates documents that may not be read from several threads at
+         *        once, or `options` has no capacity or no shard.
+         */
+        explicit JsonDocumentCache(JsonWrapperFactory factory, const JsonCacheOptions& options = {});
+
+        ~JsonDocumentCache();
+
+        JsonDocumentCache(const JsonDocumentCache&) = delete;
+
+        JsonDocumentCache& operator=(const JsonDocumentCache&) = delete;
+
+        JsonDocumentCache(JsonDocumentCache&&) = delete;
+
+        JsonDocumentCache& operator=(JsonDocumentCache&&) = delete;
+
+        /**
+         * @brief The document parsed from `json`: the cached one if `json` was seen recently, a new one otherwise.
+         * @param json The text to parse. It is copied into the cache on a miss.
+         * @throw XJsonError If parsing fails; nothing is cached then.
+         */
+        std::shared_ptr<const IJsonWrapper> Parse(std::string_view json);
+
+        /**
+         * @brief Number of documents cached.
+         */
+        std::size_t Size() const;
+
+        /**
+         * @brief Drop every document. Handles already given out stay valid. The counters are kept.
+         */
+        void Clear();
+
+        JsonCacheStatistics Statistics() const;
+
+    private:
+        /**
+         * @brief One independently locked part of the cache.
+         */
+        struct Shard;
+
+        JsonWrapperFactory _factory;
+
+        /**
+         * @brief Documents kept at most per shard.
+         */
+        std::size_t _shardCapacity;
+
+        std::size_t _shardCount;
+
+        std::unique_ptr<Shard[]> _shards;
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_JSONDOCUMENTCACHE_HPP_
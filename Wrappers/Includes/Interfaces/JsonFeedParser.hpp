@@ -0,0 +1,101 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_JSONFEEDPARSER_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_JSONFEEDPARSER_HPP_
+
+#include <memory>
+#include <string_view>
+
+namespace Wrappers
+{
+    class IJsonWrapper;
+
+    /**
+     * @interface IJsonFeedCursor
+     * @brief Backend side of a `Wrappers::JsonFeedParser`, created by `IJsonWrapper::OpenFeed()`.
+     */
+    class IJsonFeedCursor
+    {
+    public:
+        virtual ~IJsonFeedCursor() = default;
+
+        /**
+         * @brief Consume the next chunk of the document.
+         * @param chunk The bytes that follow the previous chunk. Only valid during the call.
+         * @throw XJsonError If the document is malformed so far.
+         */
+        virtual void Feed(std::string_view chunk) = 0;
+
+        /**
+         * @brief Complete the document after its last chunk.
+         * @throw XJsonError If the document is incomplete or malformed.
+         */
+        virtual void Finish() = 0;
+
+    protected:
+        IJsonFeedCursor() = default;
+    };
+
+    /**
+     * @class JsonFeedParser
+     * @brief Parses a document pushed in chunks of any size, e.g. as they come off a socket, into a wrapper.
+     * @note When the root is an object, each top level member is parsed into the wrapper as soon as its last byte
+     *       arrives and can be read right away, while the rest of the document is still being received. Only the
+     *       member being received is buffered. The nlohmann and simdjson backends also append the elements of a
+     *       root array, and of an array member still open at the end of a chunk, one by one, so that only the
+     *       element being received is buffered. Other roots are buffered and parsed by `Finish()`.
+     *
+     * @code
+     * Wrappers::NlohmannJsonWrapper request;
+     * Wrappers::JsonFeedParser parser{request};
+     * while (socket.Receive(chunk))
+     * {
+     *     parser.Feed(chunk);
+     * }
+     * parser.Finish();
+     * @endcode
+     */
+    class JsonFeedParser
+    {
+    public:
+        /**
+         * @param document Receives the document; its previous content is replaced once the first byte of the new
+         *        root is fed. Must outlive the parser.
+         */
+        explicit JsonFeedParser(IJsonWrapper& document);
+
+        ~JsonFeedParser();
+
+        JsonFeedParser(const JsonFeedParser&) = delete;
+
+        JsonFeedParser& operator=(const JsonFeedParser&) = delete;
+
+        JsonFeedParser(JsonFeedParser&&) = delete;
+
+        JsonFeedParser& operator=(JsonFeedParser&&) = delete;
+
+        /**
+         * @brief Parse the next chunk of the document.
+         * @param chunk The bytes that follow the previous chunk; may split a token anywhere. Not referenced after
+         *        the call returns.
+         * @throw XJsonError If the document is malformed so far, or after `Finish()`. The parser cannot go on then
+         *        and the wrapper keeps the members parsed before the error.
+         */
+        void Feed(std::string_view chunk);
+
+        /**
+         * @brief Complete the document after its last chunk.
+         * @throw XJsonError If the document is incomplete or malformed, or `Finish()` was already called.
+         */
+        void Finish();
+
+    private:
+        /**
+         * @brief Backend state, holding the part of the document not parsed yet.
+         */
+        std::unique_ptr<IJsonFeedCursor> _cursor;
+
+        bool _finished{false};
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_JSONFEEDPARSER_HPP_
@@ -0,0 +1,67 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_JSONKEY_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_JSONKEY_HPP_
+
+#include <cstddef>
+#include <string_view>
+
+namespace Wrappers
+{
+    /**
+     * @class JsonKey
+     * @brief Pre-hashed, interned top level key, for lookups repeated with the same key, e.g. in a hot loop.
+     * @note Equal names share one interned copy for the lifetime of the process, so two keys are equal exactly when
+     *       their names point to the same bytes. Interning locks a process-wide mutex; create keys once and reuse them.
+     * @note Backends may use the hash to find a member without comparing every key; the others fall back to their
+     *       regular lookup by name. Only `SimdJsonWrapper` uses it, to skip the scan of the document text. The
+     *       nlohmann backends already find a member in O(log n) in their sorted objects and gain nothing from a
+     *       key over its name: a hash index would have to be dropped by every setter.
+     *
+     * @code
+     * static const Wrappers::JsonKey timestamp{"timestamp"};
+     * const int64_t time = jsonWrapper.GetInt(timestamp);
+     * @endcode
+     */
+    class JsonKey
+    {
+    public:
+        /**
+         * @brief Intern a key.
+         * @param name The unescaped key.
+         */
+        explicit JsonKey(std::string_view name);
+
+        /**
+         * @brief The unescaped key, in interned storage that is never released.
+         */
+        std::string_view Name() const
+        {
+            return _name;
+        }
+
+        /**
+         * @brief `std::hash<std::string_view>` of `Name()`.
+         */
+        std::size_t Hash() const
+        {
+            return _hash;
+        }
+
+        bool operator==(const JsonKey& other) const
+        {
+            return _name.data() == other._name.data();
+        }
+
+        bool operator!=(const JsonKey& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        std::string_view _name;
+
+        std::size_t _hash;
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_JSONKEY_HPP_
@@ -0,0 +1,51 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_JSONPATH_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_JSONPATH_HPP_
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Wrappers
+{
+    /**
+     * @class JsonPath
+     * @brief Pre-compiled location of a nested value, e.g. `/a/b/c` or `a.b.c`.
+     * @note A segment made of decimal digits (without leading zeros) selects an array element, e.g. `/points/0/x`.
+     * @note Parse a path once and reuse it; lookups then walk the unescaped segments without re-parsing.
+     */
+    class JsonPath
+    {
+    public:
+        /**
+         * @brief Compile a path.
+         * @param path A JSON Pointer (RFC 6901) if it starts with '/', otherwise '.' separated keys.
+         *             The empty string is the whole document.
+         * @throw XJsonError If the path is malformed, e.g. a bad '~' escape or an empty dotted key.
+         */
+        explicit JsonPath(std::string_view path);
+
+        /**
+         * @brief The unescaped keys or array indices, outermost first.
+         */
+        const std::vector<std::string>& Segments() const;
+
+        /**
+         * @brief The same path as a JSON Pointer.
+         */
+        const std::string& Pointer() const;
+
+    private:
+        /**
+         * @brief The unescaped keys, outermost first.
+         */
+        std::vector<std::string> _segments;
+
+        /**
+         * @brief Canonical JSON Pointer form of `_segments`.
+         */
+        std::string _pointer;
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_JSONPATH_HPP_
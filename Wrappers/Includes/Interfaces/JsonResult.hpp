@@ -0,0 +1,113 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_JSONRESULT_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_JSONRESULT_HPP_
+
+#include <utility>
+
+#include "Exceptions/XJsonError.hpp"
+
+namespace Wrappers
+{
+    /**
+     * @enum JsonErrorCode
+     * @brief Why a `TryGet*()` lookup produced no value.
+     */
+    enum class JsonErrorCode
+    {
+        /**
+         * @brief The lookup succeeded.
+         */
+        None,
+
+        /**
+         * @brief The key or path doesn't exist, or its parent is not an object / array.
+         */
+        NoSuchKey,
+
+        /**
+         * @brief The value exists but cannot be converted to the requested type.
+         */
+        IncorrectType
+    };
+
+    /**
+     * @class JsonResult
+     * @brief A value or the reason why there is none, returned by the non-throwing `TryGet*()` lookups.
+     * @tparam TValue The looked up type.
+     *
+     * @code
+     * const auto retries = jsonWrapper.TryGetInt("retries");
+     * Schedule(retries.ValueOr(3));
+     * @endcode
+     */
+    template<typename TValue>
+    class JsonResult
+    {
+    public:
+        JsonResult(TValue value) : _value{std::move(value)}, _error{JsonErrorCode::None}
+        {
+        }
+
+        JsonResult(JsonErrorCode error) : _value{}, _error{error}
+        {
+        }
+
+        /**
+         * @brief Whether the lookup produced a value.
+         */
+        bool HasValue() const
+        {
+            return JsonErrorCode::None == _error;
+        }
+
+        explicit operator bool() const
+        {
+            return HasValue();
+        }
+
+        /**
+         * @brief Why there is no value, `JsonErrorCode::None` if there is one.
+         */
+        JsonErrorCode Error() const
+        {
+            return _error;
+        }
+
+        /**
+         * @brief The value.
+         * @throw XJsonError If there is none.
+         */
+        const TValue& Value() const
+        {
+            if (!HasValue())
+            {
+                throw XJsonError{"No value in JSON result."};
+            }
+
+            return _value;
+        }
+
+        /**
+         * @brief The value, or `fallback` if there is none.
+         */
+        TValue ValueOr(TValue fallback) const
+        {
+            return HasValue() ? _value : fallback;
+        }
+
+        /**
+         * @brief The value, unchecked.
+         */
+        const TValue& operator*() const
+        {
+            return _value;
+        }
+
+    private:
+        TValue _value;
+
+        JsonErrorCode _error;
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_JSONRESULT_HPP_
@@ -0,0 +1,137 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_JSONSTREAM_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_JSONSTREAM_HPP_
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace Wrappers
+{
+    class IJsonWrapper;
+
+    /**
+     * @struct JsonStreamOptions
+     * @brief Tuning of a `Wrappers::JsonStream`. Backends ignore what they cannot use.
+     */
+    struct JsonStreamOptions
+    {
+        /**
+         * @brief Bytes indexed at once; must be larger than the largest document (simdjson).
+         */
+        std::size_t batchSize{1000000};
+
+        /**
+         * @brief Index the next batch on a background thread while the current one is read (simdjson, when built
+         *        with thread support).
+         */
+        bool threaded{false};
+
+        /**
+         * @brief Readable bytes after the end of the batch, e.g. spare room in the caller's buffer. A backend that
+         *        reads past the end copies the batch unless there are enough (simdjson: 64).
+         */
+        std::size_t padding{0};
+    };
+
+    /**
+     * @interface IJsonStreamCursor
+     * @brief Backend side of a `Wrappers::JsonStream`, created by `IJsonWrapper::OpenStream()`.
+     */
+    class IJsonStreamCursor
+    {
+    public:
+        virtual ~IJsonStreamCursor() = default;
+
+        /**
+         * @brief Load the next document into the wrapper that opened the cursor.
+         * @return @b false once every document has been read.
+         * @throw XJsonError If the next document is malformed.
+         */
+        virtual bool Next() = 0;
+
+        /**
+         * @brief Byte offset of the last document read, from the start of the batch.
+         */
+        virtual std::size_t Offset() const = 0;
+
+    protected:
+        IJsonStreamCursor() = default;
+    };
+
+    /**
+     * @class JsonStream
+     * @brief Reads the documents of an NDJSON / JSON Lines batch one after the other into a single wrapper.
+     * @note One document per line; blank lines are skipped. The simdjson backend also accepts documents spread over
+     *       several lines or separated by other whitespace.
+     * @note The wrapper and, for the backends that have one, its parser are reused for every document, so that
+     *       reading a batch does not allocate per document once warmed up.
+     *
+     * @code
+     * Wrappers::SimdJsonWrapper jsonWrapper;
+     * Wrappers::JsonStream stream{jsonWrapper, batch};
+     * while (stream.Next())
+     * {
+     *     Ship(jsonWrapper.GetStringView("message"));
+     * }
+     * @endcode
+     */
+    class JsonStream
+    {
+    public:
+        /**
+         * @brief Iterate the documents of a batch held by the caller.
+         * @param document Receives each document in turn; its previous content is replaced by the first `Next()`.
+         * @param batch The documents. Must outlive the stream.
+         * @param options Backend tuning.
+         * @throw XJsonError If the backend cannot start reading the batch.
+         */
+        JsonStream(IJsonWrapper& document, std::string_view batch, const JsonStreamOptions& options = {});
+
+        /**
+         * @brief Iterate the documents read from `input`, e.g. a `std::ifstream`.
+         * @note The whole input is read into a buffer owned by the stream before the first document is parsed,
+         *       with room after it for the backends that read past the end, so that they need not copy it.
+         * @throw XJsonError If reading fails or the backend cannot start reading the batch.
+         */
+        JsonStream(IJsonWrapper& document, std::istream& input, const JsonStreamOptions& options = {});
+
+        ~JsonStream();
+
+        JsonStream(const JsonStream&) = delete;
+
+        JsonStream& operator=(const JsonStream&) = delete;
+
+        JsonStream(JsonStream&&) = delete;
+
+        JsonStream& operator=(JsonStream&&) = delete;
+
+        /**
+         * @brief Parse the next document into the wrapper given at construction.
+         * @return @b false once every document has been read.
+         * @throw XJsonError If the next document is malformed. Reading may go on with the following documents,
+         *        unless the backend lost track of the document boundaries, in which case `Next()` returns false.
+         */
+        bool Next();
+
+        /**
+         * @brief Byte offset of the current document, from the start of the batch.
+         */
+        std::size_t Offset() const;
+
+    private:
+        /**
+         * @brief The batch read by the `std::istream` constructor; empty otherwise.
+         */
+        std::string _ownedBatch;
+
+        /**
+         * @brief Backend state, positioned on the current document.
+         */
+        std::unique_ptr<IJsonStreamCursor> _cursor;
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_JSONSTREAM_HPP_
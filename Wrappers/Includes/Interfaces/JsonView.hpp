@@ -0,0 +1,287 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_JSONVIEW_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_JSONVIEW_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Wrappers
+{
+    class IJsonWrapper;
+    class JsonView;
+
+    /**
+     * @struct JsonNode
+     * @brief Opaque handle of a value inside the document of a `Wrappers::IJsonWrapper`.
+     * @note Only the implementation that produced a handle can interpret it. An empty handle (`data == nullptr`)
+     *       stands for a missing value.
+     */
+    struct JsonNode
+    {
+        /**
+         * @brief Backend specific pointer to the value.
+         */
+        const void* data{nullptr};
+
+        /**
+         * @brief Backend specific extent of the value, e.g. the length of its text.
+         */
+        std::size_t size{0};
+    };
+
+    /**
+     * @interface IJsonMemberVisitor
+     * @brief Receives the members of an object from `JsonView::ForEachMember()`.
+     */
+    class IJsonMemberVisitor
+    {
+    public:
+        virtual ~IJsonMemberVisitor() = default;
+
+        /**
+         * @brief Called once per member, in the order the backend keeps them.
+         * @param key The unescaped key. Valid for the duration of the call only.
+         * @param value View of the member's value.
+         */
+        virtual void Visit(std::string_view key, const JsonView& value) = 0;
+
+    protected:
+        IJsonMemberVisitor() = default;
+    };
+
+    /**
+     * @class JsonView
+     * @brief Non-owning, read-only view of a value inside a `Wrappers::IJsonWrapper` document.
+     * @note Members of a viewed object are read by key; the viewed value itself is read with the `As*()` getters,
+     *       e.g. the elements of an array obtained with `Element()`.
+     * @note Reading through a view neither copies the subtree nor allocates a wrapper.
+     * @note A view borrows from its owner and is invalidated by any setter, `Parse()` or destruction of the owner.
+     */
+    class JsonView
+    {
+    public:
+        /**
+         * @brief Create a view of `node`, which must have been produced by `owner`.
+         */
+        JsonView(const IJsonWrapper& owner, JsonNode node);
+
+        /**
+         * @brief Get an integer value from the viewed object.
+         * @throw XJsonError If the key doesn't exist or type conversion fails.
+         */
+        int64_t GetInt(std::string_view key) const;
+
+        /**
+         * @brief Get an unsigned integer value from the viewed object.
+         * @throw XJsonError If the key doesn't exist or type conversion fails.
+         */
+        uint64_t GetUnsigned(std::string_view key) const;
+
+        /**
+         * @brief Get a double value from the viewed object.
+         * @throw XJsonError If the key doesn't exist or type conversion fails.
+         */
+        double GetDouble(std::string_view key) const;
+
+        /**
+         * @brief Get a boolean value from the viewed object.
+         * @throw XJsonError If the key doesn't exist or type conversion fails.
+         */
+        bool GetBool(std::string_view key) const;
+
+        /**
+         * @brief Get a copy of a string value from the viewed object.
+         * @throw XJsonError If the key doesn't exist or type conversion fails.
+         */
+        std::string GetString(std::string_view key) const;
+
+        /**
+         * @brief Get a string value from the viewed object without copying it.
+         * @throw XJsonError If the key doesn't exist or type conversion fails.
+         */
+        std::string_view GetStringView(std::string_view key) const;
+
+        /**
+         * @brief Get a view of an inner object.
+         * @throw XJsonError If the key doesn't exist or the value is not an object.
+         */
+        JsonView GetObjectView(std::string_view key) const;
+
+        /**
+         * @brief Get a view of an inner array.
+         * @throw XJsonError If the key doesn't exist or the value is not an array.
+         */
+        JsonView GetArrayView(std::string_view key) const;
+
+        /**
+         * @brief Check if a value of the viewed object is null.
+         * @throw XJsonError If the key doesn't exist.
+         */
+        bool IsNull(std::string_view key) const;
+
+        /**
+         * @brief Checks if a key is present in the viewed object.
+         */
+        bool HasKey(std::string_view key) const;
+
+        /**
+         * @brief Number of elements of the viewed array.
+         * @throw XJsonError If the viewed value is not an array.
+         */
+        std::size_t Size() const;
+
+        /**
+         * @brief Get a view of an element of the viewed array.
+         * @throw XJsonError If the viewed value is not an array or `index` is out of range.
+         * @note Tree backends index in O(1); text backends scan the array, so prefer the bulk getters for long
+         *       arrays of numbers.
+         */
+        JsonView Element(std::size_t index) const;
+
+        /**
+         * @brief Get views of all the elements of the viewed array, walking it once.
+         * @throw XJsonError If the viewed value is not an array.
+         * @note Prefer it to `Element()` in a loop, which the text backends answer from a single cached array.
+         */
+        std::vector<JsonView> Elements() const;
+
+        /**
+         * @brief Visit every member of the viewed object in a single pass.
+         * @throw XJsonError If the viewed value is not an object, or whatever `visitor` throws.
+         * @note Members are visited in document order, except by the nlohmann backends, which keep them sorted.
+         *       The simdjson backend walks the text once instead of looking every key up from the start.
+         */
+        void ForEachMember(IJsonMemberVisitor& visitor) const;
+
+        /**
+         * @brief Get the viewed value as an integer.
+         * @throw XJsonError If type conversion fails.
+         */
+        int64_t AsInt() const;
+
+        /**
+         * @brief Get the viewed value as an unsigned integer.
+         * @throw XJsonError If type conversion fails.
+         */
+        uint64_t AsUnsigned() const;
+
+        /**
+         * @brief Get the viewed value as a double.
+         * @throw XJsonError If type conversion fails.
+         */
+        double AsDouble() const;
+
+        /**
+         * @brief Get the viewed value as a boolean.
+         * @throw XJsonError If type conversion fails.
+         */
+        bool AsBool() const;
+
+        /**
+         * @brief Get a copy of the viewed string.
+         * @throw XJsonError If the viewed value is not a string.
+         */
+        std::string AsString() const;
+
+        /**
+         * @brief Get the viewed string without copying it.
+         * @throw XJsonError If the viewed value is not a string.
+         */
+        std::string_view AsStringView() const;
+
+        /**
+         * @brief Convert the viewed array of integers in a single pass.
+         * @param values Replaced by the elements of the array; its capacity is reused.
+         * @throw XJsonError If the viewed value is not an array or an element fails conversion.
+         */
+        void AsIntArray(std::vector<int64_t>& values) const;
+
+        /**
+         * @brief Convert the viewed array of integers in a single pass into caller provided memory.
+         * @return Number of elements written.
+         * @throw XJsonError If the viewed value is not an array, an element fails conversion or the array has more
+         *        than `capacity` elements.
+         */
+        std::size_t AsIntArray(int64_t* values, std::size_t capacity) const;
+
+        /**
+         * @brief Convert the viewed array of unsigned integers in a single pass.
+         * @throw XJsonError If the viewed value is not an array or an element fails conversion.
+         */
+        void AsUnsignedArray(std::vector<uint64_t>& values) const;
+
+        /**
+         * @brief Convert the viewed array of unsigned integers in a single pass into caller provided memory.
+         * @return Number of elements written.
+         * @throw XJsonError If the viewed value is not an array, an element fails conversion or the array has more
+         *        than `capacity` elements.
+         */
+        std::size_t AsUnsignedArray(uint64_t* values, std::size_t capacity) const;
+
+        /**
+         * @brief Convert the viewed array of doubles in a single pass.
+         * @throw XJsonError If the viewed value is not an array or an element fails conversion.
+         */
+        void AsDoubleArray(std::vector<double>& values) const;
+
+        /**
+         * @brief Convert the viewed array of doubles in a single pass into caller provided memory.
+         * @return Number of elements written.
+         * @throw XJsonError If the viewed value is not an array, an element fails conversion or the array has more
+         *        than `capacity` elements.
+         */
+        std::size_t AsDoubleArray(double* values, std::size_t capacity) const;
+
+        /**
+         * @brief Check if the viewed value is null.
+         */
+        bool IsNull() const;
+
+        /**
+         * @brief Check if the viewed value is an object.
+         */
+        bool IsObject() const;
+
+        /**
+         * @brief Check if the viewed value is an array.
+         */
+        bool IsArray() const;
+
+        /**
+         * @brief Copy the viewed value into a new wrapper of the owner's type.
+         */
+        std::unique_ptr<IJsonWrapper> ToObject() const;
+
+        /**
+         * @brief Serialize the viewed value, in the same form as `IJsonWrapper::ToString()`.
+         */
+        std::string ToString() const;
+
+        /**
+         * @brief Handle of the viewed value, for the `Node*()` functions of the owner.
+         */
+        JsonNode Node() const;
+
+    private:
+        /**
+         * @brief Handle of the member `key`, empty if it doesn't exist.
+         */
+        JsonNode Member(std::string_view key) const;
+
+        /**
+         * @brief The document the view borrows from.
+         */
+        const IJsonWrapper* _owner;
+
+        /**
+         * @brief The viewed value.
+         */
+        JsonNode _node;
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_JSONVIEW_HPP_
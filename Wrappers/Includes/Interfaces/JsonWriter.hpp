@@ -0,0 +1,192 @@
+#ifndef _INCLUDE_JSON_WRAPPER_INTERFACES_JSONWRITER_HPP_
+#define _INCLUDE_JSON_WRAPPER_INTERFACES_JSONWRITER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Details/JsonOutput.hpp"
+#include "Interfaces/IJsonHandler.hpp"
+
+namespace Wrappers
+{
+    class IJsonSink;
+    class IJsonWrapper;
+
+    /**
+     * @class JsonWriter
+     * @brief Writes a document value by value straight into a string, a caller buffer or a sink, without building
+     *        a tree first, e.g. to emit a response.
+     * @note The text is formatted as `ToString()` formats it. Members are written in call order, so the two are
+     *       identical when the keys of each object are written sorted, the canonical order of every backend.
+     *       Duplicate keys are not detected.
+     * @note Only the nesting is kept, one byte per open array or object.
+     *
+     * @code
+     * std::string response;
+     * Wrappers::JsonWriter writer{response};
+     * writer.BeginObject();
+     * writer.Key("id");
+     * writer.Int(7);
+     * writer.Key("tags");
+     * writer.BeginArray();
+     * writer.String("new");
+     * writer.EndArray();
+     * writer.EndObject();
+     * writer.Finish();
+     * @endcode
+     */
+    class JsonWriter final : public IJsonHandler
+    {
+    public:
+        /**
+         * @brief Append to `output`, reusing its capacity.
+         * @note `output` holds the document once `Finish()` returns or the writer is destroyed, not before.
+         */
+        explicit JsonWriter(std::string& output);
+
+        /**
+         * @brief Write to a caller buffer. No terminating NUL is written.
+         * @note Bytes past `capacity` are dropped but counted by `Finish()`, so that the document can be written
+         *       again into a large enough buffer.
+         */
+        JsonWriter(char* buffer, std::size_t capacity);
+
+        /**
+         * @brief Hand the output to `sink` a few kilobytes at a time.
+         */
+        explicit JsonWriter(IJsonSink& sink);
+
+        ~JsonWriter() override = default;
+
+        JsonWriter(const JsonWriter&) = delete;
+
+        JsonWriter& operator=(const JsonWriter&) = delete;
+
+        JsonWriter(JsonWriter&&) = delete;
+
+        JsonWriter& operator=(JsonWriter&&) = delete;
+
+        /**
+         * @brief Open an object; its members follow as `Key()` and a value each.
+         * @throw XJsonError If no value is expected here.
+         */
+        void BeginObject() override;
+
+        /**
+         * @brief Close the innermost object.
+         * @throw XJsonError If the innermost open value is not an object, or its last key has no value.
+         */
+        void EndObject() override;
+
+        /**
+         * @brief Open an array; its elements follow as values.
+         * @throw XJsonError If no value is expected here.
+         */
+        void BeginArray() override;
+
+        /**
+         * @brief Close the innermost array.
+         * @throw XJsonError If the innermost open value is not an array.
+         */
+        void EndArray() override;
+
+        /**
+         * @brief Write the key of the next member of the innermost object.
+         * @throw XJsonError If the innermost open value is not an object, it expects a value, or `key` is not valid
+         *        UTF-8.
+         */
+        void Key(std::string_view key) override;
+
+        /**
+         * @brief Write an integer value.
+         * @throw XJsonError If no value is expected here.
+         */
+        void Int(int64_t value) override;
+
+        /**
+         * @brief Same as above, for an unsigned value.
+         */
+        void Unsigned(uint64_t value) override;
+
+        /**
+         * @brief Same as above, for a double in the shortest form that round-trips.
+         * @note Non-finite values are written as `null`, as `ToString()` writes them.
+         */
+        void Double(double value) override;
+
+        /**
+         * @brief Same as above, for a boolean.
+         */
+        void Bool(bool value) override;
+
+        /**
+         * @brief Write a string value.
+         * @throw XJsonError If no value is expected here, or `value` is not valid UTF-8.
+         */
+        void String(std::string_view value) override;
+
+        /**
+         * @brief Write a `null` value.
+         * @throw XJsonError If no value is expected here.
+         */
+        void Null() override;
+
+        /**
+         * @brief Write a parsed document as a value, as its `ToString()` would, without copying it first.
+         * @throw XJsonError If no value is expected here, or the document cannot be serialized.
+         */
+        void Embed(const IJsonWrapper& document);
+
+        /**
+         * @brief Complete the document: flush a sink and trim a string to what was written.
+         * @return Length of the document.
+         * @throw XJsonError If no value was written, or an array or object is still open.
+         */
+        std::size_t Finish();
+
+    private:
+        enum class Scope : unsigned char
+        {
+            Object,
+            Array
+        };
+
+        /**
+         * @brief Check that a value may follow and write the separator before it.
+         */
+        void BeginValue();
+
+        /**
+         * @brief Mark the document complete when the root value is done.
+         */
+        void EndValue();
+
+        Details::JsonOutput _output;
+
+        /**
+         * @brief Open arrays and objects, innermost last.
+         */
+        std::vector<Scope> _scopes;
+
+        /**
+         * @brief Whether the innermost open value has no element or member yet.
+         */
+        bool _first{true};
+
+        /**
+         * @brief Whether a key was written and its value not yet.
+         */
+        bool _afterKey{false};
+
+        /**
+         * @brief Whether the root value is done.
+         */
+        bool _complete{false};
+    };
+
+}  // namespace Wrappers
+
+#endif  // _INCLUDE_JSON_WRAPPER_INTERFACES_JSONWRITER_HPP_
@@ -0,0 +1,861 @@
+#include "Interfaces/IJsonWrapper.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Details/JsonBinaryCodec.hpp"
+#include "Details/JsonEventReader.hpp"
+#include "Details/JsonMemberSplitter.hpp"
+#include "Details/JsonOutput.hpp"
+#include "Details/JsonTextFormat.hpp"
+#include "Details/MappedFile.hpp"
+#include "Details/MemoryResource.hpp"
+#include "Details/Parallel.hpp"
+#include "Exceptions/XJsonError.hpp"
+#include "Interfaces/IJsonHandler.hpp"
+#include "Interfaces/JsonFeedParser.hpp"
+#include "Interfaces/JsonKey.hpp"
+#include "Interfaces/JsonPath.hpp"
+#include "Interfaces/JsonStream.hpp"
+#include "Interfaces/JsonView.hpp"
+
+namespace Wrappers
+{
+    namespace
+    {
+        /**
+         * @brief Read a path segment as an array index: decimal digits, without leading zeros (RFC 6901).
+         * @return @b false if the segment is not an index.
+         */
+        bool ToIndex(std::string_view segment, std::size_t& index)
+        {
+            if (segment.empty() || (segment.size() > 1 && '0' == segment.front()))
+            {
+                return false;
+            }
+
+            const char* end = segment.data() + segment.size();
+            const auto [last, error] = std::from_chars(segment.data(), end, index);
+            return std::errc{} == error && end == last;
+        }
+
+        /**
+         * @class LineCursor
+         * @brief JSON Lines splitter used by the default `IJsonWrapper::OpenStream()`.
+         */
+        class LineCursor : public IJsonStreamCursor
+        {
+        public:
+            LineCursor(IJsonWrapper& document, std::string_view batch) : _document{&document}, _batch{batch}
+            {
+            }
+
+            bool Next() override
+            {
+                while (_next < _batch.size())
+                {
+                    const std::size_t end = std::min(_batch.find('\n', _next), _batch.size());
+                    const std::string_view line = _batch.substr(_next, end - _next);
+                    _offset = _next;
+                    _next = end + 1;
+
+                    if (std::string_view::npos == line.find_first_not_of(" \t\r"))
+                    {
+                        continue;
+                    }
+
+                    _document->Parse(line);
+                    return true;
+                }
+
+                return false;
+            }
+
+            std::size_t Offset() const override
+            {
+                return _offset;
+            }
+
+        private:
+            IJsonWrapper* _document;
+            std::string_view _batch;
+            std::size_t _next{0};
+            std::size_t _offset{0};
+        };
+
+        /**
+         * @class MemberCursor
+         * @brief Incremental parser used by the default `IJsonWrapper::OpenFeed()`.
+         */
+        class MemberCursor : public IJsonFeedCursor
+        {
+        public:
+            explicit MemberCursor(IJsonWrapper& document) : _document{&document}
+            {
+            }
+
+            void Feed(std::string_view chunk) override
+            {
+                const bool started = _splitter.IsObject();
+                const std::vector<Details::JsonMemberSplitter::Member>& members = _splitter.Feed(chunk);
+                if (!started && _splitter.IsObject())
+                {
+                    _document->Parse("{}");
+                }
+
+                for (const Details::JsonMemberSplitter::Member& member : members)
+                {
+                    std::unique_ptr<IJsonWrapper> value = _document->GetEmptyObject();
+                    value->Parse(member.value);
+                    _document->SetObject(member.key, std::move(value));
+                }
+            }
+
+            void Finish() override
+            {
+                const std::string_view text = _splitter.Finish();
+                if (!_splitter.IsObject())
+                {
+                    _document->Parse(text);
+                }
+            }
+
+        private:
+            IJsonWrapper* _document;
+            Details::JsonMemberSplitter _splitter;
+        };
+
+        /**
+         * @brief Pieces a thread of `IJsonWrapper::SerializeParallel()` gets on average, so that a thread that drew
+         *        small values goes on with another piece instead of idling.
+         */
+        constexpr std::size_t kPiecesPerThread = 8;
+
+        /**
+         * @brief A member of the container split by `IJsonWrapper::SerializeParallel()`; arrays leave the key empty.
+         */
+        struct SplitItem
+        {
+            std::string key;
+            JsonNode value;
+        };
+
+        /**
+         * @class MemberCollector
+         * @brief Collects the members of an object in canonical order: sorted by key, the last of duplicates kept.
+         */
+        class MemberCollector : public IJsonMemberVisitor
+        {
+        public:
+            void Visit(std::string_view key, const JsonView& value) override
+            {
+                _members.push_back(SplitItem{std::string{key}, value.Node()});
+            }
+
+            std::vector<SplitItem> TakeMembers()
+            {
+                std::stable_sort(_members.begin(), _members.end(), [](const SplitItem& lhs, const SplitItem& rhs) {
+                    return lhs.key < rhs.key;
+                });
+
+                std::vector<SplitItem> members;
+                members.reserve(_members.size());
+                for (std::size_t i = 0; i < _members.size(); ++i)
+                {
+                    if (i + 1 == _members.size() || _members[i].key != _members[i + 1].key)
+                    {
+                        members.push_back(std::move(_members[i]));
+                    }
+                }
+
+                _members.clear();
+                return members;
+            }
+
+        private:
+            std::vector<SplitItem> _members;
+        };
+
+    }  // namespace
+
+    JsonView IJsonWrapper::GetObjectView(std::string_view key) const
+    {
+        return View().GetObjectView(key);
+    }
+
+    JsonView IJsonWrapper::View() const
+    {
+        return JsonView{*this, RootNode()};
+    }
+
+    JsonView IJsonWrapper::GetArrayView(std::string_view key) const
+    {
+        return View().GetArrayView(key);
+    }
+
+    std::size_t IJsonWrapper::GetArraySize(std::string_view key) const
+    {
+        return GetArrayView(key).Size();
+    }
+
+    void IJsonWrapper::GetIntArray(std::string_view key, std::vector<int64_t>& values) const
+    {
+        GetArrayView(key).AsIntArray(values);
+    }
+
+    std::size_t IJsonWrapper::GetIntArray(std::string_view key, int64_t* values, std::size_t capacity) const
+    {
+        return NodeToIntArray(MemberNode(RootNode(), key), values, capacity);
+    }
+
+    void IJsonWrapper::GetUnsignedArray(std::string_view key, std::vector<uint64_t>& values) const
+    {
+        GetArrayView(key).AsUnsignedArray(values);
+    }
+
+    std::size_t IJsonWrapper::GetUnsignedArray(std::string_view key, uint64_t* values, std::size_t capacity) const
+    {
+        return NodeToUnsignedArray(MemberNode(RootNode(), key), values, capacity);
+    }
+
+    void IJsonWrapper::GetDoubleArray(std::string_view key, std::vector<double>& values) const
+    {
+        GetArrayView(key).AsDoubleArray(values);
+    }
+
+    std::size_t IJsonWrapper::GetDoubleArray(std::string_view key, double* values, std::size_t capacity) const
+    {
+        return NodeToDoubleArray(MemberNode(RootNode(), key), values, capacity);
+    }
+
+    bool IJsonWrapper::AllowsConcurrentReads() const
+    {
+        return false;
+    }
+
+    void IJsonWrapper::SetInt(const JsonPath& path, int64_t value)
+    {
+        SetAtPath(path.Segments().begin(), path.Segments().end(), [value](IJsonWrapper& parent, std::string_view key) {
+            parent.SetInt(key, value);
+        });
+    }
+
+    void IJsonWrapper::SetUnsigned(const JsonPath& path, uint64_t value)
+    {
+        SetAtPath(path.Segments().begin(), path.Segments().end(), [value](IJsonWrapper& parent, std::string_view key) {
+            parent.SetUnsigned(key, value);
+        });
+    }
+
+    void IJsonWrapper::SetDouble(const JsonPath& path, double value)
+    {
+        SetAtPath(path.Segments().begin(), path.Segments().end(), [value](IJsonWrapper& parent, std::string_view key) {
+            parent.SetDouble(key, value);
+        });
+    }
+
+    void IJsonWrapper::SetBool(const JsonPath& path, bool value)
+    {
+        SetAtPath(path.Segments().begin(), path.Segments().end(), [value](IJsonWrapper& parent, std::string_view key) {
+            parent.SetBool(key, value);
+        });
+    }
+
+    void IJsonWrapper::SetString(const JsonPath& path, std::string_view value)
+    {
+        SetAtPath(path.Segments().begin(), path.Segments().end(), [value](IJsonWrapper& parent, std::string_view key) {
+            parent.SetString(key, value);
+        });
+    }
+
+    void IJsonWrapper::SetObject(const JsonPath& path, std::unique_ptr<IJsonWrapper> jsonObject)
+    {
+        SetAtPath(path.Segments().begin(),
+                  path.Segments().end(),
+                  [&jsonObject](IJsonWrapper& parent, std::string_view key) {
+                      parent.SetObject(key, std::move(jsonObject));
+                  });
+    }
+
+    void IJsonWrapper::SetNull(const JsonPath& path)
+    {
+        SetAtPath(path.Segments().begin(), path.Segments().end(), [](IJsonWrapper& parent, std::string_view key) {
+            parent.SetNull(key);
+        });
+    }
+
+    int64_t IJsonWrapper::GetInt(const JsonPath& path) const
+    {
+        return NodeToInt(PathNode(path));
+    }
+
+    uint64_t IJsonWrapper::GetUnsigned(const JsonPath& path) const
+    {
+        return NodeToUnsigned(PathNode(path));
+    }
+
+    double IJsonWrapper::GetDouble(const JsonPath& path) const
+    {
+        return NodeToDouble(PathNode(path));
+    }
+
+    bool IJsonWrapper::GetBool(const JsonPath& path) const
+    {
+        return NodeToBool(PathNode(path));
+    }
+
+    std::string IJsonWrapper::GetString(const JsonPath& path) const
+    {
+        return std::string{NodeToStringView(PathNode(path))};
+    }
+
+    std::string_view IJsonWrapper::GetStringView(const JsonPath& path) const
+    {
+        return NodeToStringView(PathNode(path));
+    }
+
+    JsonView IJsonWrapper::GetObjectView(const JsonPath& path) const
+    {
+        const JsonNode node = PathNode(path);
+        if (!NodeIsObject(node))
+        {
+            throw XJsonError("Failed to get Inner Object.");
+        }
+
+        return JsonView{*this, node};
+    }
+
+    JsonView IJsonWrapper::GetArrayView(const JsonPath& path) const
+    {
+        const JsonNode node = PathNode(path);
+        if (!NodeIsArray(node))
+        {
+            throw XJsonError("Failed to get Array.");
+        }
+
+        return JsonView{*this, node};
+    }
+
+    bool IJsonWrapper::IsNull(const JsonPath& path) const
+    {
+        return NodeIsNull(PathNode(path));
+    }
+
+    bool IJsonWrapper::HasKey(const JsonPath& path) const
+    {
+        return nullptr != PathNode(path).data;
+    }
+
+    // by name; only the getters of backends that can use the hash of a key override these
+    void IJsonWrapper::SetInt(const JsonKey& key, int64_t value)
+    {
+        SetInt(key.Name(), value);
+    }
+
+    void IJsonWrapper::SetUnsigned(const JsonKey& key, uint64_t value)
+    {
+        SetUnsigned(key.Name(), value);
+    }
+
+    void IJsonWrapper::SetDouble(const JsonKey& key, double value)
+    {
+        SetDouble(key.Name(), value);
+    }
+
+    void IJsonWrapper::SetBool(const JsonKey& key, bool value)
+    {
+        SetBool(key.Name(), value);
+    }
+
+    void IJsonWrapper::SetString(const JsonKey& key, std::string_view value)
+    {
+        SetString(key.Name(), value);
+    }
+
+    void IJsonWrapper::SetObject(const JsonKey& key, std::unique_ptr<IJsonWrapper> jsonObject)
+    {
+        SetObject(key.Name(), std::move(jsonObject));
+    }
+
+    void IJsonWrapper::SetNull(const JsonKey& key)
+    {
+        SetNull(key.Name());
+    }
+
+    int64_t IJsonWrapper::GetInt(const JsonKey& key) const
+    {
+        return GetInt(key.Name());
+    }
+
+    uint64_t IJsonWrapper::GetUnsigned(const JsonKey& key) const
+    {
+        return GetUnsigned(key.Name());
+    }
+
+    double IJsonWrapper::GetDouble(const JsonKey& key) const
+    {
+        return GetDouble(key.Name());
+    }
+
+    bool IJsonWrapper::GetBool(const JsonKey& key) const
+    {
+        return GetBool(key.Name());
+    }
+
+    std::string IJsonWrapper::GetString(const JsonKey& key) const
+    {
+        return GetString(key.Name());
+    }
+
+    std::string_view IJsonWrapper::GetStringView(const JsonKey& key) const
+    {
+        return GetStringView(key.Name());
+    }
+
+    bool IJsonWrapper::IsNull(const JsonKey& key) const
+    {
+        return IsNull(key.Name());
+    }
+
+    bool IJsonWrapper::HasKey(const JsonKey& key) const
+    {
+        return HasKey(key.Name());
+    }
+
+    JsonResult<int64_t> IJsonWrapper::TryGetInt(std::string_view key) const
+    {
+        return TryConvert(MemberNode(RootNode(), key), &IJsonWrapper::NodeTryToInt);
+    }
+
+    JsonResult<uint64_t> IJsonWrapper::TryGetUnsigned(std::string_view key) const
+    {
+        return TryConvert(MemberNode(RootNode(), key), &IJsonWrapper::NodeTryToUnsigned);
+    }
+
+    JsonResult<double> IJsonWrapper::TryGetDouble(std::string_view key) const
+    {
+        return TryConvert(MemberNode(RootNode(), key), &IJsonWrapper::NodeTryToDouble);
+    }
+
+    JsonResult<bool> IJsonWrapper::TryGetBool(std::string_view key) const
+    {
+        return TryConvert(MemberNode(RootNode(), key), &IJsonWrapper::NodeTryToBool);
+    }
+
+    JsonResult<std::string> IJsonWrapper::TryGetString(std::string_view key) const
+    {
+        const JsonResult<std::string_view> result = TryGetStringView(key);
+        if (!result)
+        {
+            return result.Error();
+        }
+
+        return std::string{*result};
+    }
+
+    JsonResult<std::string_view> IJsonWrapper::TryGetStringView(std::string_view key) const
+    {
+        return TryConvert(MemberNode(RootNode(), key), &IJsonWrapper::NodeTryToStringView);
+    }
+
+    JsonResult<int64_t> IJsonWrapper::TryGetInt(const JsonPath& path) const
+    {
+        return TryConvert(PathNode(path), &IJsonWrapper::NodeTryToInt);
+    }
+
+    JsonResult<uint64_t> IJsonWrapper::TryGetUnsigned(const JsonPath& path) const
+    {
+        return TryConvert(PathNode(path), &IJsonWrapper::NodeTryToUnsigned);
+    }
+
+    JsonResult<double> IJsonWrapper::TryGetDouble(const JsonPath& path) const
+    {
+        return TryConvert(PathNode(path), &IJsonWrapper::NodeTryToDouble);
+    }
+
+    JsonResult<bool> IJsonWrapper::TryGetBool(const JsonPath& path) const
+    {
+        return TryConvert(PathNode(path), &IJsonWrapper::NodeTryToBool);
+    }
+
+    JsonResult<std::string> IJsonWrapper::TryGetString(const JsonPath& path) const
+    {
+        const JsonResult<std::string_view> result = TryGetStringView(path);
+        if (!result)
+        {
+            return result.Error();
+        }
+
+        return std::string{*result};
+    }
+
+    JsonResult<std::string_view> IJsonWrapper::TryGetStringView(const JsonPath& path) const
+    {
+        return TryConvert(PathNode(path), &IJsonWrapper::NodeTryToStringView);
+    }
+
+    JsonNode IJsonWrapper::PathNode(const JsonPath& path) const
+    {
+        JsonNode node = RootNode();
+        for (const std::string& segment : path.Segments())
+        {
+            std::size_t index = 0;
+            if (!NodeIsArray(node))
+            {
+                node = MemberNode(node, segment);
+            }
+            else if (ToIndex(segment, index))
+            {
+                node = ElementNode(node, index);
+            }
+            else
+            {
+                node = JsonNode{};
+            }
+
+            if (nullptr == node.data)
+            {
+                break;
+            }
+        }
+
+        return node;
+    }
+
+    std::unique_ptr<IJsonWrapper> IJsonWrapper::DetachObject(std::string_view key)
+    {
+        return GetObject(key);
+    }
+
+    std::vector<JsonNode> IJsonWrapper::ElementNodes(JsonNode array) const
+    {
+        const std::size_t size = NodeArraySize(array);
+
+        std::vector<JsonNode> elements;
+        elements.reserve(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            elements.push_back(ElementNode(array, i));
+        }
+
+        return elements;
+    }
+
+    void IJsonWrapper::NodeSerializeConcurrent(JsonNode node, Details::JsonOutput& output) const
+    {
+        NodeSerialize(node, output);
+    }
+
+    void IJsonWrapper::NodeEmit(JsonNode node, IJsonHandler& handler) const
+    {
+        std::string text;
+        Details::JsonOutput jsonOutput{text};
+        NodeSerialize(node, jsonOutput);
+        jsonOutput.Finish();
+
+        Details::ReadEvents(text, handler);
+    }
+
+    void IJsonWrapper::EmitDocument(const IJsonWrapper& document, IJsonHandler& handler)
+    {
+        document.NodeEmit(document.RootNode(), handler);
+    }
+
+    void* IJsonWrapper::operator new(std::size_t size)
+    {
+        return Details::AllocateTagged(size, std::pmr::get_default_resource());
+    }
+
+    void* IJsonWrapper::operator new(std::size_t size, std::pmr::memory_resource* resource)
+    {
+        return Details::AllocateTagged(size, (nullptr != resource) ? resource : std::pmr::get_default_resource());
+    }
+
+    void* IJsonWrapper::operator new(std::size_t size, std::align_val_t alignment)
+    {
+        return Details::AllocateTagged(size, std::pmr::get_default_resource(), static_cast<std::size_t>(alignment));
+    }
+
+    void* IJsonWrapper::operator new(std::size_t size,
+                                     std::align_val_t alignment,
+                                     std::pmr::memory_resource* resource)
+    {
+        return Details::AllocateTagged(size,
+                                       (nullptr != resource) ? resource : std::pmr::get_default_resource(),
+                                       static_cast<std::size_t>(alignment));
+    }
+
+    void* IJsonWrapper::operator new(std::size_t /*size*/, void* place) noexcept
+    {
+        return place;
+    }
+
+    void IJsonWrapper::operator delete(void* memory) noexcept
+    {
+        Details::DeallocateTagged(memory);
+    }
+
+    void IJsonWrapper::operator delete(void* memory, std::pmr::memory_resource* /*resource*/) noexcept
+    {
+        Details::DeallocateTagged(memory);
+    }
+
+    void IJsonWrapper::operator delete(void* memory, std::align_val_t alignment) noexcept
+    {
+        Details::DeallocateTagged(memory, static_cast<std::size_t>(alignment));
+    }
+
+    void IJsonWrapper::operator delete(void* memory,
+                                       std::align_val_t alignment,
+                                       std::pmr::memory_resource* /*resource*/) noexcept
+    {
+        Details::DeallocateTagged(memory, static_cast<std::size_t>(alignment));
+    }
+
+    void IJsonWrapper::operator delete(void* /*memory*/, void* /*place*/) noexcept {}
+
+    void IJsonWrapper::Parse(const char* jsonString, std::size_t length)
+    {
+        Parse(std::string_view{jsonString, length});
+    }
+
+    void IJsonWrapper::ParseLazy(std::string_view jsonString)
+    {
+        Parse(jsonString);
+    }
+
+    void IJsonWrapper::ParseFile(const std::string& filePath)
+    {
+        const Details::MappedFile mappedFile{filePath, 0};
+        Parse(std::string_view{mappedFile.Data(), mappedFile.Size()});
+    }
+
+    void IJsonWrapper::SerializeTo(std::string& output) const
+    {
+        output.clear();
+
+        Details::JsonOutput jsonOutput{output};
+        NodeSerialize(RootNode(), jsonOutput);
+        jsonOutput.Finish();
+    }
+
+    std::size_t IJsonWrapper::SerializeTo(char* buffer, std::size_t capacity) const
+    {
+        Details::JsonOutput jsonOutput{buffer, capacity};
+        NodeSerialize(RootNode(), jsonOutput);
+
+        return jsonOutput.Finish();
+    }
+
+    std::size_t IJsonWrapper::SerializeTo(IJsonSink& sink) const
+    {
+        Details::JsonOutput jsonOutput{sink};
+        NodeSerialize(RootNode(), jsonOutput);
+
+        return jsonOutput.Finish();
+    }
+
+    void IJsonWrapper::SerializeParallel(std::string& output, std::size_t threadCount) const
+    {
+        std::vector<std::string> pieces;
+        SerializeParallel(pieces, threadCount);
+
+        std::size_t size = 0;
+        for (const std::string& piece : pieces)
+        {
+            size += piece.size();
+        }
+
+        output.clear();
+        output.reserve(size);
+        for (std::string& piece : pieces)
+        {
+            output += piece;
+            std::string{}.swap(piece);
+        }
+    }
+
+    void IJsonWrapper::SerializeParallel(std::vector<std::string>& pieces, std::size_t threadCount) const
+    {
+        pieces.clear();
+
+        // descend through containers holding a single container, keeping the text around the one to split
+        std::string prefix;
+        std::string suffix;
+        JsonNode container = RootNode();
+        std::vector<SplitItem> items;
+        bool isObject = false;
+        while (true)
+        {
+            isObject = NodeIsObject(container);
+            if (isObject)
+            {
+                MemberCollector collector;
+                NodeForEachMember(container, collector);
+                items = collector.TakeMembers();
+            }
+            else if (NodeIsArray(container))
+            {
+                items.clear();
+                for (const JsonNode element : ElementNodes(container))
+                {
+                    items.push_back(SplitItem{std::string{}, element});
+                }
+            }
+            else
+            {
+                pieces.emplace_back();
+                Details::JsonOutput jsonOutput{pieces.back()};
+                NodeSerialize(container, jsonOutput);
+                jsonOutput.Finish();
+                return;
+            }
+
+            if (1 != items.size() || !(NodeIsObject(items.front().value) || NodeIsArray(items.front().value)))
+            {
+                break;
+            }
+
+            prefix += isObject ? '{' : '[';
+            if (isObject)
+            {
+                Details::AppendString(prefix, items.front().key);
+                prefix += ':';
+            }
+            suffix.insert(suffix.begin(), isObject ? '}' : ']');
+            container = items.front().value;
+        }
+
+        prefix += isObject ? '{' : '[';
+        suffix.insert(suffix.begin(), isObject ? '}' : ']');
+
+        if (0 == threadCount)
+        {
+            threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+        const std::size_t pieceCount =
+            std::clamp<std::size_t>(threadCount * kPiecesPerThread, 1, std::max<std::size_t>(items.size(), 1));
+        pieces.resize(pieceCount);
+
+        Details::RunParallel(pieceCount, threadCount, [&](std::size_t piece) {
+            std::string& text = pieces[piece];
+            Details::JsonOutput jsonOutput{text};
+            if (0 == piece)
+            {
+                jsonOutput.append(prefix);
+            }
+
+            const std::size_t last = (piece + 1) * items.size() / pieceCount;
+            for (std::size_t i = piece * items.size() / pieceCount; i < last; ++i)
+            {
+                if (0 != i)
+                {
+                    jsonOutput.push_back(',');
+                }
+                if (isObject)
+                {
+                    Details::AppendString(jsonOutput, items[i].key);
+                    jsonOutput.push_back(':');
+                }
+                NodeSerializeConcurrent(items[i].value, jsonOutput);
+            }
+
+            if (pieceCount == piece + 1)
+            {
+                jsonOutput.append(suffix);
+            }
+            jsonOutput.Finish();
+        });
+    }
+
+    std::vector<std::uint8_t> IJsonWrapper::ToBinary(JsonBinaryFormat format) const
+    {
+        return Details::TextToBinary(ToString(), format);
+    }
+
+    void IJsonWrapper::ParseBinary(JsonBinaryFormat format, const std::uint8_t* bytes, std::size_t size)
+    {
+        Parse(Details::BinaryToText(bytes, size, format));
+    }
+
+    std::unique_ptr<IJsonStreamCursor> IJsonWrapper::OpenStream(std::string_view batch,
+                                                                const JsonStreamOptions& /*options*/)
+    {
+        return std::make_unique<LineCursor>(*this, batch);
+    }
+
+    std::unique_ptr<IJsonFeedCursor> IJsonWrapper::OpenFeed()
+    {
+        return std::make_unique<MemberCursor>(*this);
+    }
+
+    template<typename TSetter>
+    void IJsonWrapper::SetAtPath(std::vector<std::string>::const_iterator first,
+                                 std::vector<std::string>::const_iterator last,
+                                 TSetter&& setter)
+    {
+        if (first == last)
+        {
+            throw XJsonError{"Cannot set a value at the root of the document."};
+        }
+
+        const std::string& key = *first;
+        if (std::next(first) == last)
+        {
+            setter(*this, key);
+            return;
+        }
+
+        const JsonNode member = MemberNode(RootNode(), key);
+        const bool exists = (nullptr != member.data);
+        if (exists && !NodeIsObject(member) && !NodeIsNull(member))
+        {
+            throw XJsonError{"Cannot set a member on a JSON value that is not an object."};
+        }
+
+        std::unique_ptr<IJsonWrapper> child = exists ? DetachObject(key) : GetEmptyObject();
+        try
+        {
+            child->SetAtPath(std::next(first), last, setter);
+        }
+        catch (const XJsonError&)
+        {
+            if (exists)
+            {
+                SetObject(key, std::move(child));
+            }
+            throw;
+        }
+
+        SetObject(key, std::move(child));
+    }
+
+    template<typename TValue>
+    JsonResult<TValue> IJsonWrapper::TryConvert(JsonNode node,
+                                                JsonErrorCode (IJsonWrapper::*convert)(JsonNode, TValue&) const) const
+    {
+        if (nullptr == node.data)
+        {
+            return JsonErrorCode::NoSuchKey;
+        }
+
+        TValue value{};
+        const JsonErrorCode error = (this->*convert)(node, value);
+        if (JsonErrorCode::None != error)
+        {
+            return error;
+        }
+
+        return value;
+    }
+
+}  // namespace Wrappers
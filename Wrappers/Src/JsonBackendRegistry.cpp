@@ -0,0 +1,161 @@
+#include "Interfaces/JsonBackendRegistry.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Exceptions/XJsonError.hpp"
+#include "Implementations/NlohmannJsonWrapper.hpp"
+#include "Implementations/SimdJsonWrapper.hpp"
+
+namespace Wrappers
+{
+    namespace
+    {
+        /**
+         * @brief Create a wrapper in `resource`, taking its values from there too when the backend can.
+         */
+        template<typename TJsonWrapper>
+        std::unique_ptr<IJsonWrapper> MakeWrapper(std::pmr::memory_resource* resource)
+        {
+            if constexpr (std::is_constructible_v<TJsonWrapper, std::pmr::memory_resource*>)
+            {
+                return std::unique_ptr<IJsonWrapper>{new (resource) TJsonWrapper(resource)};
+            }
+            else
+            {
+                return std::unique_ptr<IJsonWrapper>{new (resource) TJsonWrapper()};
+            }
+        }
+
+        bool RegisterBuiltins(JsonBackendRegistry& registry)
+        {
+            registry.Register("nlohmann", MakeWrapper<NlohmannJsonWrapper>);
+            registry.Register("nlohmann-flat", MakeWrapper<NlohmannFlatJsonWrapper>);
+            registry.Register("nlohmann-pmr", MakeWrapper<NlohmannPmrJsonWrapper>);
+            registry.Register("simdjson", MakeWrapper<SimdJsonWrapper>);
+
+            registry.Prefer(JsonWorkload::ReadMostly, "simdjson");
+            registry.Prefer(JsonWorkload::LowMemory, "nlohmann-flat");
+            return true;
+        }
+
+        std::size_t ToIndex(JsonWorkload workload)
+        {
+            return static_cast<std::size_t>(workload);
+        }
+
+    }  // namespace
+
+    JsonBackendRegistry::JsonBackendRegistry() : _mutex{}, _factories{}, _preferred{}
+    {
+        _preferred.fill("nlohmann");
+    }
+
+    JsonBackendRegistry& JsonBackendRegistry::Instance()
+    {
+        static JsonBackendRegistry registry;
+        [[maybe_unused]] static const bool registered = RegisterBuiltins(registry);
+
+        return registry;
+    }
+
+    void JsonBackendRegistry::Register(std::string_view name, Factory factory)
+    {
+        if (name.empty() || !factory)
+        {
+            throw XJsonError{"A JSON backend needs a name and a factory."};
+        }
+
+        const std::unique_lock lock{_mutex};
+        _factories.insert_or_assign(std::string{name}, std::move(factory));
+    }
+
+    void JsonBackendRegistry::Prefer(JsonWorkload workload, std::string_view name)
+    {
+        const std::unique_lock lock{_mutex};
+        const Factory& factory = Find(name);
+        if (JsonWorkload::SharedReads == workload)
+        {
+            const std::unique_ptr<IJsonWrapper> probe = factory(nullptr);
+            if (nullptr == probe || !probe->AllowsConcurrentReads())
+            {
+                throw XJsonError{"The JSON backend '" + std::string{name} + "' doesn't allow concurrent reads."};
+            }
+        }
+        _preferred[ToIndex(workload)] = name;
+    }
+
+    std::string JsonBackendRegistry::PreferredName(JsonWorkload workload) const
+    {
+        const std::shared_lock lock{_mutex};
+        return _preferred[ToIndex(workload)];
+    }
+
+    bool JsonBackendRegistry::Contains(std::string_view name) const
+    {
+        const std::shared_lock lock{_mutex};
+        return _factories.find(name) != _factories.end();
+    }
+
+    std::vector<std::string> JsonBackendRegistry::Names() const
+    {
+        const std::shared_lock lock{_mutex};
+
+        std::vector<std::string> names;
+        names.reserve(_factories.size());
+        for (const auto& [name, factory] : _factories)
+        {
+            names.push_back(name);
+        }
+
+        return names;
+    }
+
+    std::unique_ptr<IJsonWrapper> JsonBackendRegistry::Create(std::string_view name,
+                                                              std::pmr::memory_resource* resource) const
+    {
+        const std::shared_lock lock{_mutex};
+        return Find(name)(resource);
+    }
+
+    std::unique_ptr<IJsonWrapper> JsonBackendRegistry::Create(JsonWorkload workload,
+                                                              std::pmr::memory_resource* resource) const
+    {
+        const std::shared_lock lock{_mutex};
+        return Find(_preferred[ToIndex(workload)])(resource);
+    }
+
+    JsonWrapperFactory JsonBackendRegistry::MakeFactory(std::string_view name,
+                                                        std::pmr::memory_resource* resource) const
+    {
+        const std::shared_lock lock{_mutex};
+        return [factory = Find(name), resource] { return factory(resource); };
+    }
+
+    JsonWrapperFactory JsonBackendRegistry::MakeFactory(JsonWorkload workload,
+                                                        std::pmr::memory_resource* resource) const
+    {
+        const std::shared_lock lock{_mutex};
+        return [factory = Find(_preferred[ToIndex(workload)]), resource] { return factory(resource); };
+    }
+
+    const JsonBackendRegistry::Factory& JsonBackendRegistry::Find(std::string_view name) const
+    {
+        const auto factory = _factories.find(name);
+        if (factory == _factories.end())
+        {
+            throw XJsonError{"No JSON backend is registered as '" + std::string{name} + "'."};
+        }
+
+        return factory->second;
+    }
+
+}  // namespace Wrappers
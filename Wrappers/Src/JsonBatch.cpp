@@ -0,0 +1,56 @@
+#include "Interfaces/JsonBatch.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Details/Parallel.hpp"
+#include "Exceptions/XJsonError.hpp"
+#include "Interfaces/IJsonWrapper.hpp"
+
+namespace Wrappers
+{
+    std::vector<std::unique_ptr<IJsonWrapper>> ParseBatch(const JsonWrapperFactory& factory,
+                                                          const std::string_view* documents,
+                                                          std::size_t count,
+                                                          const JsonBatchOptions& options)
+    {
+        if (nullptr == factory || (nullptr == documents && 0 != count))
+        {
+            throw XJsonError{"Invalid JSON batch."};
+        }
+
+        std::vector<std::unique_ptr<IJsonWrapper>> results(count);
+
+        const std::size_t chunkSize = std::max<std::size_t>(options.chunkSize, 1);
+        const std::size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+        Details::RunParallel(chunkCount, options.threadCount, [&](std::size_t chunk) {
+            const std::size_t last = std::min((chunk + 1) * chunkSize, count);
+            for (std::size_t i = chunk * chunkSize; i < last; ++i)
+            {
+                try
+                {
+                    std::unique_ptr<IJsonWrapper> document = factory();
+                    if (nullptr == document)
+                    {
+                        throw XJsonError{"Could not create a JSON document."};
+                    }
+
+                    document->Parse(documents[i]);
+                    results[i] = std::move(document);
+                }
+                catch (const std::exception& e)
+                {
+                    throw XJsonError{"Failed to parse document " + std::to_string(i) + ": " + e.what()};
+                }
+            }
+        });
+
+        return results;
+    }
+
+}  // namespace Wrappers
@@ -0,0 +1,207 @@
+#include "Details/JsonBinaryCodec.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "Details/JsonTextFormat.hpp"
+#include "Exceptions/XJsonError.hpp"
+#include "Interfaces/JsonBinaryFormat.hpp"
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        namespace
+        {
+            /**
+             * @class TextWriter
+             * @brief SAX handler of nlohmann's binary readers that writes the events out as JSON text.
+             */
+            class TextWriter
+            {
+            public:
+                explicit TextWriter(std::string& out) : _out{out}
+                {
+                }
+
+                bool null()
+                {
+                    Separate();
+                    _out += "null";
+                    return true;
+                }
+
+                bool boolean(bool value)
+                {
+                    Separate();
+                    _out += value ? "true" : "false";
+                    return true;
+                }
+
+                bool number_integer(int64_t value)
+                {
+                    Separate();
+                    AppendInt(_out, value);
+                    return true;
+                }
+
+                bool number_unsigned(uint64_t value)
+                {
+                    Separate();
+                    AppendUnsigned(_out, value);
+                    return true;
+                }
+
+                bool number_float(double value, const std::string& /*text*/)
+                {
+                    Separate();
+                    AppendDouble(_out, value);
+                    return true;
+                }
+
+                bool string(std::string& value)
+                {
+                    Separate();
+                    AppendString(_out, value);
+                    return true;
+                }
+
+                bool binary(nlohmann::json::binary_t& /*value*/)
+                {
+                    _holdsBinary = true;
+                    return false;
+                }
+
+                bool start_object(std::size_t /*size*/)
+                {
+                    Separate();
+                    _out += '{';
+                    _first.push_back(true);
+                    return true;
+                }
+
+                bool key(std::string& key)
+                {
+                    Separate();
+                    AppendString(_out, key);
+                    _out += ':';
+                    _afterKey = true;
+                    return true;
+                }
+
+                bool end_object()
+                {
+                    _out += '}';
+                    _first.pop_back();
+                    return true;
+                }
+
+                bool start_array(std::size_t /*size*/)
+                {
+                    Separate();
+                    _out += '[';
+                    _first.push_back(true);
+                    return true;
+                }
+
+                bool end_array()
+                {
+                    _out += ']';
+                    _first.pop_back();
+                    return true;
+                }
+
+                bool parse_error(std::size_t /*position*/,
+                                 const std::string& /*token*/,
+                                 const nlohmann::detail::exception& /*error*/)
+                {
+                    return false;
+                }
+
+                /**
+                 * @brief Whether reading stopped at a byte string, which has no JSON counterpart.
+                 */
+                bool HoldsBinary() const
+                {
+                    return _holdsBinary;
+                }
+
+            private:
+                /**
+                 * @brief Write the comma before a value or key, unless it is the first of its container or the value
+                 *        of a key.
+                 */
+                void Separate()
+                {
+                    if (_afterKey)
+                    {
+                        _afterKey = false;
+                    }
+                    else if (!_first.empty())
+                    {
+                        if (!_first.back())
+                        {
+                            _out += ',';
+                        }
+                        _first.back() = false;
+                    }
+                }
+
+                std::string& _out;
+
+                /**
+                 * @brief Per open container, whether nothing was written in it yet.
+                 */
+                std::vector<bool> _first;
+
+                bool _afterKey{false};
+
+                bool _holdsBinary{false};
+            };
+
+        }  // namespace
+
+        std::vector<std::uint8_t> TextToBinary(std::string_view json, JsonBinaryFormat format)
+        {
+            try
+            {
+                const nlohmann::json document = nlohmann::json::parse(json);
+                return (JsonBinaryFormat::Cbor == format) ? nlohmann::json::to_cbor(document)
+                                                          : nlohmann::json::to_msgpack(document);
+            }
+            catch (const nlohmann::json::exception& e)
+            {
+                throw XJsonError{"Failed to convert JSON object to binary."};
+            }
+        }
+
+        std::string BinaryToText(const std::uint8_t* bytes, std::size_t size, JsonBinaryFormat format)
+        {
+            if (nullptr == bytes && 0 != size)
+            {
+                throw XJsonError{"Failed to parse binary JSON."};
+            }
+
+            std::string json;
+            json.reserve(size * 2);
+            TextWriter writer{json};
+            const auto inputFormat = (JsonBinaryFormat::Cbor == format) ? nlohmann::json::input_format_t::cbor
+                                                                        : nlohmann::json::input_format_t::msgpack;
+            if (!nlohmann::json::sax_parse(bytes, bytes + size, &writer, inputFormat))
+            {
+                throw XJsonError{writer.HoldsBinary()
+                                     ? "Failed to parse binary JSON: byte strings have no JSON counterpart."
+                                     : "Failed to parse binary JSON."};
+            }
+
+            return json;
+        }
+
+    }  // namespace Details
+
+}  // namespace Wrappers
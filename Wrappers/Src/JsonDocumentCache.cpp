@@ -0,0 +1,183 @@
+#include "Interfaces/JsonDocumentCache.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "Exceptions/XJsonError.hpp"
+#include "Interfaces/IJsonWrapper.hpp"
+
+namespace Wrappers
+{
+    struct JsonDocumentCache::Shard
+    {
+        struct Entry
+        {
+            std::size_t hash;
+
+            /**
+             * @brief The parsed text, compared on lookup since different texts may share a hash.
+             */
+            std::string text;
+
+            std::shared_ptr<const IJsonWrapper> document;
+        };
+
+        using Entries = std::list<Entry>;
+
+        /**
+         * @brief The entry holding `json`, moved to the front as the most recently used; `entries.end()` if none.
+         */
+        Entries::iterator Find(std::size_t hash, std::string_view json)
+        {
+            const auto [first, last] = index.equal_range(hash);
+            for (auto candidate = first; candidate != last; ++candidate)
+            {
+                if (candidate->second->text == json)
+                {
+                    entries.splice(entries.begin(), entries, candidate->second);
+                    return candidate->second;
+                }
+            }
+
+            return entries.end();
+        }
+
+        std::mutex mutex;
+
+        /**
+         * @brief Most recently used first.
+         */
+        Entries entries;
+
+        std::unordered_multimap<std::size_t, Entries::iterator> index;
+
+        JsonCacheStatistics statistics;
+    };
+
+    JsonDocumentCache::JsonDocumentCache(JsonWrapperFactory factory, const JsonCacheOptions& options)
+        : _factory{std::move(factory)},
+          _shardCapacity{0},
+          _shardCount{options.shardCount},
+          _shards{}
+    {
+        if (nullptr == _factory || 0 == options.capacity || 0 == options.shardCount)
+        {
+            throw XJsonError{"Invalid JSON document cache options."};
+        }
+
+        const std::unique_ptr<IJsonWrapper> probe = _factory();
+        if (nullptr == probe || !probe->AllowsConcurrentReads())
+        {
+            throw XJsonError{"The JSON documents of a cache must allow concurrent reads."};
+        }
+
+        _shardCapacity = (options.capacity + _shardCount - 1) / _shardCount;
+        _shards = std::make_unique<Shard[]>(_shardCount);
+    }
+
+    JsonDocumentCache::~JsonDocumentCache() = default;
+
+    std::shared_ptr<const IJsonWrapper> JsonDocumentCache::Parse(std::string_view json)
+    {
+        const std::size_t hash = std::hash<std::string_view>{}(json);
+        Shard& shard = _shards[hash % _shardCount];
+
+        {
+            const std::lock_guard<std::mutex> lock{shard.mutex};
+
+            const auto entry = shard.Find(hash, json);
+            if (entry != shard.entries.end())
+            {
+                ++shard.statistics.hits;
+                return entry->document;
+            }
+            ++shard.statistics.misses;
+        }
+
+        // parse without holding the lock, so that other threads keep hitting the shard meanwhile
+        std::shared_ptr<IJsonWrapper> document = _factory();
+        if (nullptr == document)
+        {
+            throw XJsonError{"Could not create a JSON document."};
+        }
+        document->Parse(json);
+
+        const std::lock_guard<std::mutex> lock{shard.mutex};
+
+        // another thread may have stored the same text in the meantime
+        const auto entry = shard.Find(hash, json);
+        if (entry != shard.entries.end())
+        {
+            return entry->document;
+        }
+
+        shard.entries.push_front(Shard::Entry{hash, std::string{json}, document});
+        shard.index.emplace(hash, shard.entries.begin());
+
+        while (shard.entries.size() > _shardCapacity)
+        {
+            const auto oldest = std::prev(shard.entries.end());
+
+            const auto [first, last] = shard.index.equal_range(oldest->hash);
+            for (auto candidate = first; candidate != last; ++candidate)
+            {
+                if (candidate->second == oldest)
+                {
+                    shard.index.erase(candidate);
+                    break;
+                }
+            }
+
+            shard.entries.erase(oldest);
+            ++shard.statistics.evictions;
+        }
+
+        return document;
+    }
+
+    std::size_t JsonDocumentCache::Size() const
+    {
+        std::size_t size = 0;
+        for (std::size_t i = 0; i < _shardCount; ++i)
+        {
+            const std::lock_guard<std::mutex> lock{_shards[i].mutex};
+            size += _shards[i].entries.size();
+        }
+
+        return size;
+    }
+
+    void JsonDocumentCache::Clear()
+    {
+        for (std::size_t i = 0; i < _shardCount; ++i)
+        {
+            const std::lock_guard<std::mutex> lock{_shards[i].mutex};
+            _shards[i].index.clear();
+            _shards[i].entries.clear();
+        }
+    }
+
+    JsonCacheStatistics JsonDocumentCache::Statistics() const
+    {
+        JsonCacheStatistics statistics;
+        for (std::size_t i = 0; i < _shardCount; ++i)
+        {
+            const std::lock_guard<std::mutex> lock{_shards[i].mutex};
+            statistics.hits += _shards[i].statistics.hits;
+            statistics.misses += _shards[i].statistics.misses;
+            statistics.evictions += _shards[i].statistics.evictions;
+        }
+
+        return statistics;
+    }
+
+}  // namespace Wrappers
@@ -0,0 +1,125 @@
+#include "Details/JsonEventReader.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+
+#include "Exceptions/XJsonError.hpp"
+#include "Interfaces/IJsonHandler.hpp"
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        namespace
+        {
+            /**
+             * @class EventForwarder
+             * @brief SAX handler of nlohmann's parser that passes the events on to an `IJsonHandler`.
+             */
+            class EventForwarder
+            {
+            public:
+                explicit EventForwarder(IJsonHandler& handler) : _handler{handler}
+                {
+                }
+
+                bool null()
+                {
+                    _handler.Null();
+                    return true;
+                }
+
+                bool boolean(bool value)
+                {
+                    _handler.Bool(value);
+                    return true;
+                }
+
+                bool number_integer(int64_t value)
+                {
+                    _handler.Int(value);
+                    return true;
+                }
+
+                bool number_unsigned(uint64_t value)
+                {
+                    _handler.Unsigned(value);
+                    return true;
+                }
+
+                bool number_float(double value, const std::string& /*text*/)
+                {
+                    _handler.Double(value);
+                    return true;
+                }
+
+                bool string(std::string& value)
+                {
+                    _handler.String(value);
+                    return true;
+                }
+
+                bool binary(nlohmann::json::binary_t& /*value*/)
+                {
+                    return false;
+                }
+
+                bool start_object(std::size_t /*size*/)
+                {
+                    _handler.BeginObject();
+                    return true;
+                }
+
+                bool key(std::string& key)
+                {
+                    _handler.Key(key);
+                    return true;
+                }
+
+                bool end_object()
+                {
+                    _handler.EndObject();
+                    return true;
+                }
+
+                bool start_array(std::size_t /*size*/)
+                {
+                    _handler.BeginArray();
+                    return true;
+                }
+
+                bool end_array()
+                {
+                    _handler.EndArray();
+                    return true;
+                }
+
+                bool parse_error(std::size_t /*position*/,
+                                 const std::string& /*token*/,
+                                 const nlohmann::detail::exception& /*error*/)
+                {
+                    return false;
+                }
+
+            private:
+                IJsonHandler& _handler;
+            };
+
+        }  // namespace
+
+        void ReadEvents(std::string_view json, IJsonHandler& handler)
+        {
+            EventForwarder forwarder{handler};
+            if (!nlohmann::json::sax_parse(json.begin(), json.end(), &forwarder))
+            {
+                throw XJsonError{"Failed to parse JSON."};
+            }
+        }
+
+    }  // namespace Details
+
+}  // namespace Wrappers
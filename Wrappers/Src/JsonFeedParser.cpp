@@ -0,0 +1,37 @@
+#include "Interfaces/JsonFeedParser.hpp"
+
+#include <string_view>
+
+#include "Exceptions/XJsonError.hpp"
+#include "Interfaces/IJsonWrapper.hpp"
+
+namespace Wrappers
+{
+    JsonFeedParser::JsonFeedParser(IJsonWrapper& document) : _cursor{document.OpenFeed()}
+    {
+    }
+
+    JsonFeedParser::~JsonFeedParser() = default;
+
+    void JsonFeedParser::Feed(std::string_view chunk)
+    {
+        if (_finished)
+        {
+            throw XJsonError{"The JSON feed is already finished."};
+        }
+
+        _cursor->Feed(chunk);
+    }
+
+    void JsonFeedParser::Finish()
+    {
+        if (_finished)
+        {
+            throw XJsonError{"The JSON feed is already finished."};
+        }
+
+        _finished = true;
+        _cursor->Finish();
+    }
+
+}  // namespace Wrappers
@@ -0,0 +1,38 @@
+#include "Interfaces/JsonKey.hpp"
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace Wrappers
+{
+    namespace
+    {
+        /**
+         * @brief The interned names; the nodes of the set don't move when it rehashes, so names stay put.
+         */
+        struct KeyRegistry
+        {
+            std::mutex mutex;
+
+            std::unordered_set<std::string> names;
+        };
+
+        KeyRegistry& Registry()
+        {
+            static KeyRegistry registry;
+            return registry;
+        }
+    }  // namespace
+
+    JsonKey::JsonKey(std::string_view name) : _name{}, _hash{std::hash<std::string_view>{}(name)}
+    {
+        KeyRegistry& registry = Registry();
+
+        const std::lock_guard<std::mutex> lock{registry.mutex};
+        _name = *registry.names.emplace(name).first;
+    }
+
+}  // namespace Wrappers
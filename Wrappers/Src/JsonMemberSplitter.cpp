@@ -0,0 +1,477 @@
+#include "Details/JsonMemberSplitter.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "Exceptions/XJsonError.hpp"
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        namespace
+        {
+            bool IsWhitespace(char character)
+            {
+                return ' ' == character || '\t' == character || '\n' == character || '\r' == character;
+            }
+
+            /**
+             * @brief Classes of the bytes a scan stops at, as bits of `kByteClasses`.
+             */
+            constexpr std::uint8_t kStringEnd = 1;
+            constexpr std::uint8_t kStructural = 2;
+
+            /**
+             * @brief Class of each byte: `"` and `\` end a run of string bytes, `"` and brackets, braces and commas a
+             *        run of value bytes.
+             */
+            constexpr std::array<std::uint8_t, 256> kByteClasses = [] {
+                std::array<std::uint8_t, 256> classes{};
+                classes['"'] = kStringEnd | kStructural;
+                classes['\\'] = kStringEnd;
+                for (const char structural : {'{', '}', '[', ']', ','})
+                {
+                    classes[static_cast<unsigned char>(structural)] = kStructural;
+                }
+                return classes;
+            }();
+
+            /**
+             * @brief The first byte of `text` at or after `position` in one of `classes`, `text.size()` if there is
+             *        none. A table lookup per byte, where `find_first_of()` compares each byte with every delimiter.
+             */
+            std::size_t FindClass(std::string_view text, std::size_t position, std::uint8_t classes)
+            {
+                while (position < text.size() &&
+                       0 == (kByteClasses[static_cast<unsigned char>(text[position])] & classes))
+                {
+                    ++position;
+                }
+                return position;
+            }
+
+            /**
+             * @brief Decode a key with escapes.
+             * @param quoted The key with its quotes.
+             * @throw XJsonError If an escape is malformed.
+             */
+            std::string UnescapeKey(std::string_view quoted)
+            {
+                try
+                {
+                    return nlohmann::json::parse(quoted).get<std::string>();
+                }
+                catch (const nlohmann::json::exception& e)
+                {
+                    throw XJsonError{"Invalid escape in a JSON key."};
+                }
+            }
+        }  // namespace
+
+        JsonMemberSplitter::JsonMemberSplitter(bool splitArrays) : _splitArrays{splitArrays}
+        {
+        }
+
+        const std::vector<JsonMemberSplitter::Member>& JsonMemberSplitter::Feed(std::string_view chunk)
+        {
+            if (State::Failed == _state)
+            {
+                throw XJsonError{"The JSON text is malformed."};
+            }
+
+            _members.clear();
+            _unescapedKeys.clear();
+
+            // the members returned by the previous call are released; the one being received moves to the front
+            _buffer.erase(0, _consumed);
+            _position -= _consumed;
+            _keyBegin -= _consumed;
+            _keyEnd -= _consumed;
+            _valueBegin -= _consumed;
+            _elementBegin -= _consumed;
+            _consumed = 0;
+
+            if (_splitting && !_rootArray)
+            {
+                _elementKey = _unescapedKeys.emplace_back(_splitKey);
+            }
+
+            _buffer.append(chunk);
+
+            while (_position < _buffer.size())
+            {
+                const char character = _buffer[_position];
+                switch (_state)
+                {
+                    case State::Root:
+                    {
+                        if ('{' == character)
+                        {
+                            _state = State::ObjectStart;
+                        }
+                        else if ('[' == character && _splitArrays)
+                        {
+                            // the root array is split from the start, its elements having no key to keep
+                            _rootArray = true;
+                            _arrayValue = true;
+                            _splitting = true;
+                            _depth = 1;
+                            _inString = false;
+                            _elementBegin = _position + 1;
+                            _elementCount = 0;
+                            _elementKey = {};
+                            _state = State::Value;
+                        }
+                        else if (!IsWhitespace(character))
+                        {
+                            // any other root is kept whole and left to the backend
+                            _state = State::Text;
+                            _position = _buffer.size();
+                            break;
+                        }
+                        _consumed = ++_position;
+                        break;
+                    }
+
+                    case State::Text:
+                    {
+                        _position = _buffer.size();
+                        break;
+                    }
+
+                    case State::ObjectStart:
+                    case State::MemberStart:
+                    {
+                        if ('"' == character)
+                        {
+                            _keyBegin = _position + 1;
+                            _keyEscaped = false;
+                            _state = State::Key;
+                        }
+                        else if ('}' == character && State::ObjectStart == _state)
+                        {
+                            _state = State::Done;
+                        }
+                        else if (!IsWhitespace(character))
+                        {
+                            Fail("Expected a key in the JSON object.");
+                        }
+                        ++_position;
+                        break;
+                    }
+
+                    case State::Key:
+                    {
+                        const std::size_t found = FindClass(_buffer, _position, kStringEnd);
+                        if (_buffer.size() == found)
+                        {
+                            _position = found;
+                        }
+                        else if ('\\' == _buffer[found])
+                        {
+                            // the escaped character is skipped, even if it is in the next chunk
+                            _keyEscaped = true;
+                            _position = found + 2;
+                        }
+                        else
+                        {
+                            _keyEnd = found;
+                            _position = found + 1;
+                            _state = State::Colon;
+                        }
+                        break;
+                    }
+
+                    case State::Colon:
+                    {
+                        if (':' == character)
+                        {
+                            _state = State::ValueStart;
+                        }
+                        else if (!IsWhitespace(character))
+                        {
+                            Fail("Expected ':' after a key in the JSON object.");
+                        }
+                        ++_position;
+                        break;
+                    }
+
+                    case State::ValueStart:
+                    {
+                        if (!IsWhitespace(character))
+                        {
+                            _valueBegin = _position;
+                            _depth = 0;
+                            _inString = false;
+                            _arrayValue = _splitArrays && '[' == character;
+                            _elementBegin = _position + 1;
+                            _elementCount = 0;
+                            _elements.clear();
+                            _state = State::Value;
+                            break;
+                        }
+                        ++_position;
+                        break;
+                    }
+
+                    case State::Value:
+                    {
+                        if (_inString)
+                        {
+                            const std::size_t found = FindClass(_buffer, _position, kStringEnd);
+                            if (_buffer.size() == found)
+                            {
+                                _position = found;
+                            }
+                            else
+                            {
+                                _inString = ('\\' == _buffer[found]);
+                                _position = found + (_inString ? 2 : 1);
+                            }
+                            break;
+                        }
+
+                        const std::size_t found = FindClass(_buffer, _position, kStructural);
+                        if (_buffer.size() == found)
+                        {
+                            _position = found;
+                            break;
+                        }
+                        _position = found + 1;
+
+                        const char structural = _buffer[found];
+                        if ('"' == structural)
+                        {
+                            _inString = true;
+                        }
+                        else if ('{' == structural || '[' == structural)
+                        {
+                            ++_depth;
+                        }
+                        else if (1 == _depth && ',' == structural && _arrayValue)
+                        {
+                            EndElement(found, false);
+                        }
+                        else if (0 != _depth && ',' != structural)
+                        {
+                            // brackets are only counted and the backend checks that they match, except those of
+                            // a split array, whose elements only it is given
+                            --_depth;
+                            if (0 == _depth && _arrayValue)
+                            {
+                                if (_splitting)
+                                {
+                                    if (']' != structural)
+                                    {
+                                        Fail("Expected ']' to close the JSON array.");
+                                    }
+                                    EndElement(found, true);
+                                }
+                                _elements.clear();
+                                if (_rootArray)
+                                {
+                                    _state = State::Done;
+                                }
+                            }
+                        }
+                        else if (0 == _depth && ',' == structural)
+                        {
+                            EndMember(found);
+                            _state = State::MemberStart;
+                        }
+                        else if (0 == _depth && '}' == structural)
+                        {
+                            EndMember(found);
+                            _state = State::Done;
+                        }
+                        else if (0 == _depth)
+                        {
+                            Fail("Unexpected ']' in the JSON object.");
+                        }
+                        break;
+                    }
+
+                    case State::Done:
+                    {
+                        if (!IsWhitespace(character))
+                        {
+                            Fail("Unexpected content after the JSON document.");
+                        }
+                        _consumed = ++_position;
+                        break;
+                    }
+
+                    case State::Failed:
+                    default:
+                    {
+                        Fail("The JSON text is malformed.");
+                    }
+                }
+            }
+
+            if (State::Value == _state && _arrayValue && !_splitting && 0 != _depth)
+            {
+                SplitMember();
+            }
+
+            return _members;
+        }
+
+        std::string_view JsonMemberSplitter::Finish()
+        {
+            switch (_state)
+            {
+                case State::Text:
+                {
+                    return std::string_view{_buffer}.substr(_consumed);
+                }
+
+                case State::Done:
+                {
+                    return {};
+                }
+
+                case State::Root:
+                {
+                    Fail("The JSON text is empty.");
+                }
+
+                case State::ObjectStart:
+                case State::MemberStart:
+                case State::Key:
+                case State::Colon:
+                case State::ValueStart:
+                case State::Value:
+                case State::Failed:
+                default:
+                {
+                    Fail("The JSON text is incomplete.");
+                }
+            }
+        }
+
+        bool JsonMemberSplitter::IsObject() const
+        {
+            return State::Root != _state && State::Text != _state && !_rootArray;
+        }
+
+        bool JsonMemberSplitter::IsArray() const
+        {
+            return _rootArray;
+        }
+
+        void JsonMemberSplitter::Fail(const char* errorMessage)
+        {
+            _state = State::Failed;
+            throw XJsonError{errorMessage};
+        }
+
+        void JsonMemberSplitter::EndMember(std::size_t end)
+        {
+            if (_splitting)
+            {
+                // the elements are reported already; only whitespace may follow the closing bracket
+                if (!Trim(_elementBegin, end).empty())
+                {
+                    Fail("Unexpected content after a JSON array.");
+                }
+                _splitting = false;
+                _consumed = end + 1;
+                return;
+            }
+
+            const std::string_view value = Trim(_valueBegin, end);
+            if (value.empty())
+            {
+                Fail("Expected a value in the JSON object.");
+            }
+
+            _members.push_back(Member{Key(), value, Kind::Member});
+            _consumed = end + 1;
+        }
+
+        void JsonMemberSplitter::EndElement(std::size_t end, bool last)
+        {
+            const std::string_view element = Trim(_elementBegin, end);
+            if (element.empty() && (!last || 0 != _elementCount))
+            {
+                Fail("Expected a value in the JSON array.");
+            }
+
+            if (!element.empty())
+            {
+                ++_elementCount;
+                if (_splitting)
+                {
+                    _members.push_back(Member{_elementKey, element, Kind::Element});
+                }
+                else
+                {
+                    const std::size_t begin = static_cast<std::size_t>(element.data() - _buffer.data());
+                    _elements.emplace_back(begin, begin + element.size());
+                }
+            }
+
+            _elementBegin = end + 1;
+            if (_splitting)
+            {
+                _consumed = _elementBegin;
+            }
+        }
+
+        void JsonMemberSplitter::SplitMember()
+        {
+            _elementKey = Key();
+            _splitKey.assign(_elementKey);
+
+            _members.push_back(Member{_elementKey, "[]", Kind::Member});
+            for (const std::pair<std::size_t, std::size_t>& element : _elements)
+            {
+                _members.push_back(Member{_elementKey, Trim(element.first, element.second), Kind::Element});
+            }
+            _elements.clear();
+
+            // the key and the elements are released; offsets before the current element are not used any more
+            _splitting = true;
+            _keyBegin = _elementBegin;
+            _keyEnd = _elementBegin;
+            _valueBegin = _elementBegin;
+            _consumed = _elementBegin;
+        }
+
+        std::string_view JsonMemberSplitter::Key()
+        {
+            std::string_view key{_buffer.data() + _keyBegin, _keyEnd - _keyBegin};
+            if (_keyEscaped)
+            {
+                key = _unescapedKeys.emplace_back(UnescapeKey({key.data() - 1, key.size() + 2}));
+            }
+
+            return key;
+        }
+
+        std::string_view JsonMemberSplitter::Trim(std::size_t begin, std::size_t end) const
+        {
+            while (begin < end && IsWhitespace(_buffer[begin]))
+            {
+                ++begin;
+            }
+            while (end > begin && IsWhitespace(_buffer[end - 1]))
+            {
+                --end;
+            }
+
+            return std::string_view{_buffer.data() + begin, end - begin};
+        }
+
+    }  // namespace Details
+
+}  // namespace Wrappers
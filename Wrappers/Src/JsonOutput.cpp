@@ -0,0 +1,138 @@
+#include "Details/JsonOutput.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "Interfaces/IJsonSink.hpp"
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        namespace
+        {
+            /**
+             * @brief Smallest growth of a string target.
+             */
+            constexpr std::size_t kMinStringGrowth = 256;
+
+        }  // namespace
+
+        JsonOutput::JsonOutput(std::string& target)
+            : _target{Target::String}, _string{&target}, _initialSize{target.size()}
+        {
+            // the spare capacity becomes the first window
+            const std::size_t size = target.size();
+            target.resize(target.capacity());
+            _begin = target.data();
+            _cursor = _begin + size;
+            _end = _begin + target.size();
+        }
+
+        JsonOutput::JsonOutput(char* buffer, std::size_t capacity)
+            : _target{Target::Buffer}, _begin{buffer}, _cursor{buffer}, _end{buffer + capacity}
+        {
+        }
+
+        JsonOutput::JsonOutput(IJsonSink& sink) : _target{Target::Sink}, _sink{&sink}
+        {
+            _begin = _chunk.data();
+            _cursor = _begin;
+            _end = _begin + _chunk.size();
+        }
+
+        JsonOutput::~JsonOutput()
+        {
+            if (Target::String == _target)
+            {
+                _string->resize(static_cast<std::size_t>(_cursor - _begin));
+            }
+        }
+
+        void JsonOutput::append(std::size_t count, char character)
+        {
+            for (; 0 != count; --count)
+            {
+                push_back(character);
+            }
+        }
+
+        std::size_t JsonOutput::Finish()
+        {
+            const auto used = static_cast<std::size_t>(_cursor - _begin);
+            switch (_target)
+            {
+                case Target::String:
+                {
+                    _string->resize(used);
+                    _begin = _string->data();
+                    _cursor = _begin + used;
+                    _end = _cursor;
+                    return used - _initialSize;
+                }
+
+                case Target::Sink:
+                {
+                    if (0 != used)
+                    {
+                        _sink->Write(std::string_view{_begin, used});
+                    }
+                    _flushed += used;
+                    _cursor = _begin;
+                    return _flushed;
+                }
+
+                case Target::Buffer:
+                default:
+                {
+                    return _flushed + used;
+                }
+            }
+        }
+
+        void JsonOutput::Overflow(std::size_t size)
+        {
+            const auto used = static_cast<std::size_t>(_cursor - _begin);
+            if (Target::String == _target)
+            {
+                _string->resize(std::max(used + size, 2 * used + kMinStringGrowth));
+                _begin = _string->data();
+                _cursor = _begin + used;
+                _end = _begin + _string->size();
+                return;
+            }
+
+            if (Target::Sink == _target && 0 != used)
+            {
+                _sink->Write(std::string_view{_begin, used});
+            }
+
+            // a full fixed buffer keeps counting in the scratch chunk
+            _flushed += used;
+            _begin = _chunk.data();
+            _cursor = _begin;
+            _end = _begin + _chunk.size();
+        }
+
+        void JsonOutput::AppendSlow(std::string_view text)
+        {
+            while (!text.empty())
+            {
+                if (_cursor == _end)
+                {
+                    Overflow(text.size());
+                }
+
+                const std::size_t length = std::min(text.size(), static_cast<std::size_t>(_end - _cursor));
+                std::memcpy(_cursor, text.data(), length);
+                _cursor += length;
+                text.remove_prefix(length);
+            }
+        }
+
+    }  // namespace Details
+
+}  // namespace Wrappers
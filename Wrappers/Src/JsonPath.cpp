@@ -0,0 +1,119 @@
+#include "Interfaces/JsonPath.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Exceptions/XJsonError.hpp"
+
+namespace Wrappers
+{
+    namespace
+    {
+        /**
+         * @brief Decode the '~0' and '~1' escapes of a JSON Pointer reference token.
+         * @throw XJsonError If '~' is not followed by '0' or '1'.
+         */
+        std::string UnescapePointerToken(std::string_view token)
+        {
+            std::string segment;
+            segment.reserve(token.size());
+
+            for (std::size_t i = 0; i < token.size(); ++i)
+            {
+                if ('~' != token[i])
+                {
+                    segment.push_back(token[i]);
+                    continue;
+                }
+
+                if (i + 1 == token.size() || ('0' != token[i + 1] && '1' != token[i + 1]))
+                {
+                    throw XJsonError{"Invalid JSON Pointer escape."};
+                }
+
+                segment.push_back('0' == token[i + 1] ? '~' : '/');
+                ++i;
+            }
+
+            return segment;
+        }
+
+        void AppendPointerToken(std::string& pointer, std::string_view segment)
+        {
+            pointer.push_back('/');
+            for (const char character : segment)
+            {
+                if ('~' == character)
+                {
+                    pointer.append("~0");
+                }
+                else if ('/' == character)
+                {
+                    pointer.append("~1");
+                }
+                else
+                {
+                    pointer.push_back(character);
+                }
+            }
+        }
+
+    }  // namespace
+
+    JsonPath::JsonPath(std::string_view path) : _segments{}, _pointer{}
+    {
+        if (path.empty())
+        {
+            return;
+        }
+
+        const bool isPointer = ('/' == path.front());
+        if (isPointer)
+        {
+            path.remove_prefix(1);
+        }
+
+        const char separator = isPointer ? '/' : '.';
+        while (true)
+        {
+            const std::size_t end = path.find(separator);
+            const std::string_view token = path.substr(0, end);
+
+            if (isPointer)
+            {
+                _segments.push_back(UnescapePointerToken(token));
+            }
+            else if (token.empty())
+            {
+                throw XJsonError{"Invalid JSON path: empty key."};
+            }
+            else
+            {
+                _segments.emplace_back(token);
+            }
+
+            if (std::string_view::npos == end)
+            {
+                break;
+            }
+            path.remove_prefix(end + 1);
+        }
+
+        for (const std::string& segment : _segments)
+        {
+            AppendPointerToken(_pointer, segment);
+        }
+    }
+
+    const std::vector<std::string>& JsonPath::Segments() const
+    {
+        return _segments;
+    }
+
+    const std::string& JsonPath::Pointer() const
+    {
+        return _pointer;
+    }
+
+}  // namespace Wrappers
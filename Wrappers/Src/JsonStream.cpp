@@ -0,0 +1,68 @@
+#include "Interfaces/JsonStream.hpp"
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "Exceptions/XJsonError.hpp"
+#include "Interfaces/IJsonWrapper.hpp"
+
+namespace Wrappers
+{
+    namespace
+    {
+        /**
+         * @brief Bytes requested from the input per read.
+         */
+        constexpr std::size_t kReadChunkSize = 1 << 16;
+
+        /**
+         * @brief Spaces kept after a batch read from a stream, enough for every backend to read past its end.
+         */
+        constexpr std::size_t kBatchPadding = 64;
+
+    }  // namespace
+
+    JsonStream::JsonStream(IJsonWrapper& document, std::string_view batch, const JsonStreamOptions& options)
+        : _ownedBatch{}, _cursor{document.OpenStream(batch, options)}
+    {
+    }
+
+    JsonStream::JsonStream(IJsonWrapper& document, std::istream& input, const JsonStreamOptions& options)
+        : _ownedBatch{}, _cursor{}
+    {
+        std::size_t size = 0;
+        while (input)
+        {
+            _ownedBatch.resize(size + kReadChunkSize);
+            input.read(_ownedBatch.data() + size, static_cast<std::streamsize>(kReadChunkSize));
+            size += static_cast<std::size_t>(input.gcount());
+        }
+        _ownedBatch.resize(size);
+        _ownedBatch.append(kBatchPadding, ' ');
+
+        if (input.bad())
+        {
+            throw XJsonError{"Failed to read the JSON stream."};
+        }
+
+        JsonStreamOptions paddedOptions = options;
+        paddedOptions.padding = kBatchPadding;
+        _cursor = document.OpenStream(std::string_view{_ownedBatch.data(), size}, paddedOptions);
+    }
+
+    JsonStream::~JsonStream() = default;
+
+    bool JsonStream::Next()
+    {
+        return _cursor->Next();
+    }
+
+    std::size_t JsonStream::Offset() const
+    {
+        return _cursor->Offset();
+    }
+
+}  // namespace Wrappers
@@ -0,0 +1,316 @@
+#include "Details/JsonTextFormat.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#include "Details/JsonOutput.hpp"
+#include "Exceptions/XJsonError.hpp"
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        namespace
+        {
+            /**
+             * @brief Smallest and largest decimal point positions printed without an exponent.
+             * @note Same limits as nlohmann's `to_chars`, i.e. [-4, digits10].
+             */
+            constexpr int kMinPlainExponent = -4;
+            constexpr int kMaxPlainExponent = 15;
+
+            constexpr unsigned char kAsciiEnd = 0x80;
+            constexpr unsigned char kContinuationMin = 0x80;
+            constexpr unsigned char kContinuationMax = 0xBF;
+            constexpr unsigned char kControlEnd = 0x20;
+
+            /**
+             * @brief Length of the UTF-8 sequence starting at `pos`.
+             * @return Sequence length in bytes, or 0 if the sequence is malformed (RFC 3629).
+             */
+            std::size_t Utf8SequenceLength(std::string_view text, std::size_t pos)
+            {
+                const auto lead = static_cast<unsigned char>(text[pos]);
+                if (lead < kAsciiEnd)
+                {
+                    return 1;
+                }
+
+                std::size_t length = 0;
+                unsigned char secondMin = kContinuationMin;
+                unsigned char secondMax = kContinuationMax;
+
+                if (lead >= 0xC2 && lead <= 0xDF)
+                {
+                    length = 2;
+                }
+                else if (lead >= 0xE0 && lead <= 0xEF)
+                {
+                    length = 3;
+                    secondMin = (lead == 0xE0) ? 0xA0 : kContinuationMin;  // overlong
+                    secondMax = (lead == 0xED) ? 0x9F : kContinuationMax;  // surrogates
+                }
+                else if (lead >= 0xF0 && lead <= 0xF4)
+                {
+                    length = 4;
+                    secondMin = (lead == 0xF0) ? 0x90 : kContinuationMin;  // overlong
+                    secondMax = (lead == 0xF4) ? 0x8F : kContinuationMax;  // above U+10FFFF
+                }
+                else
+                {
+                    return 0;
+                }
+
+                if (pos + length > text.size())
+                {
+                    return 0;
+                }
+
+                const auto second = static_cast<unsigned char>(text[pos + 1]);
+                if (second < secondMin || second > secondMax)
+                {
+                    return 0;
+                }
+
+                for (std::size_t i = 2; i < length; ++i)
+                {
+                    const auto next = static_cast<unsigned char>(text[pos + i]);
+                    if (next < kContinuationMin || next > kContinuationMax)
+                    {
+                        return 0;
+                    }
+                }
+
+                return length;
+            }
+
+            /**
+             * @brief Escape sequence for a byte, or an empty view if the byte is copied verbatim.
+             */
+            std::string_view ShortEscape(char c)
+            {
+                switch (c)
+                {
+                    case '"':
+                        return "\\\"";
+                    case '\\':
+                        return "\\\\";
+                    case '\b':
+                        return "\\b";
+                    case '\f':
+                        return "\\f";
+                    case '\n':
+                        return "\\n";
+                    case '\r':
+                        return "\\r";
+                    case '\t':
+                        return "\\t";
+                    default:
+                        return {};
+                }
+            }
+
+            template<typename TOutput>
+            void AppendExponent(TOutput& out, int exponent)
+            {
+                out.push_back(exponent < 0 ? '-' : '+');
+
+                const int magnitude = std::abs(exponent);
+                if (magnitude < 10)
+                {
+                    out.push_back('0');
+                }
+
+                std::array<char, 8> digits{};
+                const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), magnitude);
+                out.append(std::string_view{digits.data(), static_cast<std::size_t>(result.ptr - digits.data())});
+            }
+
+            template<typename TOutput>
+            void WriteString(TOutput& out, std::string_view value)
+            {
+                out.push_back('"');
+
+                std::size_t runStart = 0;
+                std::size_t pos = 0;
+                while (pos < value.size())
+                {
+                    const char c = value[pos];
+                    const auto byte = static_cast<unsigned char>(c);
+
+                    if (byte >= kAsciiEnd)
+                    {
+                        const std::size_t length = Utf8SequenceLength(value, pos);
+                        if (0 == length)
+                        {
+                            throw XJsonError{"Invalid UTF-8 byte sequence in string value."};
+                        }
+
+                        pos += length;
+                        continue;
+                    }
+
+                    const std::string_view escape = ShortEscape(c);
+                    if (escape.empty() && byte >= kControlEnd)
+                    {
+                        ++pos;
+                        continue;
+                    }
+
+                    out.append(value.substr(runStart, pos - runStart));
+                    if (!escape.empty())
+                    {
+                        out.append(escape);
+                    }
+                    else
+                    {
+                        constexpr std::string_view hexDigits = "0123456789abcdef";
+                        out.append("\\u00");
+                        out.push_back(hexDigits[byte >> 4U]);
+                        out.push_back(hexDigits[byte & 0xFU]);
+                    }
+
+                    runStart = ++pos;
+                }
+
+                out.append(value.substr(runStart));
+                out.push_back('"');
+            }
+
+            template<typename TOutput, typename TInteger>
+            void WriteInteger(TOutput& out, TInteger value)
+            {
+                std::array<char, 24> buffer{};
+                const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+                out.append(std::string_view{buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data())});
+            }
+
+            template<typename TOutput>
+            void WriteDouble(TOutput& out, double value)
+            {
+                if (!std::isfinite(value))
+                {
+                    out.append("null");
+                    return;
+                }
+
+                if (std::signbit(value))
+                {
+                    out.push_back('-');
+                    value = -value;
+                }
+
+                // shortest round-trip digits in the form "d.ddde+XX"
+                std::array<char, 32> scientific{};
+                const auto result = std::to_chars(
+                    scientific.data(), scientific.data() + scientific.size(), value, std::chars_format::scientific);
+                const std::string_view text{scientific.data(),
+                                            static_cast<std::size_t>(result.ptr - scientific.data())};
+
+                const std::size_t exponentPos = text.find('e');
+                std::array<char, 32> digitBuffer{};
+                std::size_t digitCount = 0;
+                for (std::size_t i = 0; i < exponentPos; ++i)
+                {
+                    if ('.' != text[i])
+                    {
+                        digitBuffer[digitCount++] = text[i];
+                    }
+                }
+                const std::string_view digits{digitBuffer.data(), digitCount};
+
+                int exponent = 0;
+                const bool negativeExponent = ('-' == text[exponentPos + 1]);
+                std::from_chars(text.data() + exponentPos + 2, text.data() + text.size(), exponent);
+                exponent = negativeExponent ? -exponent : exponent;
+
+                // 'k' significant digits with the decimal point after position 'n'
+                const auto k = static_cast<int>(digits.size());
+                const int n = exponent + 1;
+
+                if (k <= n && n <= kMaxPlainExponent)
+                {
+                    // digits[000].0
+                    out.append(digits);
+                    out.append(static_cast<std::size_t>(n - k), '0');
+                    out.append(".0");
+                }
+                else if (0 < n && n <= kMaxPlainExponent)
+                {
+                    // dig.its
+                    out.append(digits.substr(0, static_cast<std::size_t>(n)));
+                    out.push_back('.');
+                    out.append(digits.substr(static_cast<std::size_t>(n)));
+                }
+                else if (kMinPlainExponent < n && n <= 0)
+                {
+                    // 0.[000]digits
+                    out.append("0.");
+                    out.append(static_cast<std::size_t>(-n), '0');
+                    out.append(digits);
+                }
+                else
+                {
+                    // d.igitse+123
+                    out.push_back(digits.front());
+                    if (k > 1)
+                    {
+                        out.push_back('.');
+                        out.append(digits.substr(1));
+                    }
+                    out.push_back('e');
+                    AppendExponent(out, n - 1);
+                }
+            }
+
+        }  // namespace
+
+        void AppendString(std::string& out, std::string_view value)
+        {
+            WriteString(out, value);
+        }
+
+        void AppendString(JsonOutput& out, std::string_view value)
+        {
+            WriteString(out, value);
+        }
+
+        void AppendInt(std::string& out, int64_t value)
+        {
+            WriteInteger(out, value);
+        }
+
+        void AppendInt(JsonOutput& out, int64_t value)
+        {
+            WriteInteger(out, value);
+        }
+
+        void AppendUnsigned(std::string& out, uint64_t value)
+        {
+            WriteInteger(out, value);
+        }
+
+        void AppendUnsigned(JsonOutput& out, uint64_t value)
+        {
+            WriteInteger(out, value);
+        }
+
+        void AppendDouble(std::string& out, double value)
+        {
+            WriteDouble(out, value);
+        }
+
+        void AppendDouble(JsonOutput& out, double value)
+        {
+            WriteDouble(out, value);
+        }
+
+    }  // namespace Details
+
+}  // namespace Wrappers
@@ -0,0 +1,215 @@
+#include "Interfaces/JsonView.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Exceptions/XJsonError.hpp"
+#include "Interfaces/IJsonWrapper.hpp"
+
+namespace Wrappers
+{
+
+    JsonView::JsonView(const IJsonWrapper& owner, JsonNode node) : _owner{&owner}, _node{node}
+    {
+    }
+
+    int64_t JsonView::GetInt(std::string_view key) const
+    {
+        return _owner->NodeToInt(Member(key));
+    }
+
+    uint64_t JsonView::GetUnsigned(std::string_view key) const
+    {
+        return _owner->NodeToUnsigned(Member(key));
+    }
+
+    double JsonView::GetDouble(std::string_view key) const
+    {
+        return _owner->NodeToDouble(Member(key));
+    }
+
+    bool JsonView::GetBool(std::string_view key) const
+    {
+        return _owner->NodeToBool(Member(key));
+    }
+
+    std::string JsonView::GetString(std::string_view key) const
+    {
+        return std::string{_owner->NodeToStringView(Member(key))};
+    }
+
+    std::string_view JsonView::GetStringView(std::string_view key) const
+    {
+        return _owner->NodeToStringView(Member(key));
+    }
+
+    JsonView JsonView::GetObjectView(std::string_view key) const
+    {
+        const JsonNode member = Member(key);
+        if (!_owner->NodeIsObject(member))
+        {
+            throw XJsonError("Failed to get Inner Object.");
+        }
+
+        return JsonView{*_owner, member};
+    }
+
+    JsonView JsonView::GetArrayView(std::string_view key) const
+    {
+        const JsonNode member = Member(key);
+        if (!_owner->NodeIsArray(member))
+        {
+            throw XJsonError("Failed to get Array.");
+        }
+
+        return JsonView{*_owner, member};
+    }
+
+    bool JsonView::IsNull(std::string_view key) const
+    {
+        return _owner->NodeIsNull(Member(key));
+    }
+
+    bool JsonView::HasKey(std::string_view key) const
+    {
+        return nullptr != Member(key).data;
+    }
+
+    std::size_t JsonView::Size() const
+    {
+        return _owner->NodeArraySize(_node);
+    }
+
+    JsonView JsonView::Element(std::size_t index) const
+    {
+        const JsonNode element = _owner->ElementNode(_node, index);
+        if (nullptr == element.data)
+        {
+            throw XJsonError("Failed to get Array element.");
+        }
+
+        return JsonView{*_owner, element};
+    }
+
+    std::vector<JsonView> JsonView::Elements() const
+    {
+        const std::vector<JsonNode> nodes = _owner->ElementNodes(_node);
+
+        std::vector<JsonView> elements;
+        elements.reserve(nodes.size());
+        for (const JsonNode node : nodes)
+        {
+            elements.emplace_back(*_owner, node);
+        }
+
+        return elements;
+    }
+
+    void JsonView::ForEachMember(IJsonMemberVisitor& visitor) const
+    {
+        _owner->NodeForEachMember(_node, visitor);
+    }
+
+    int64_t JsonView::AsInt() const
+    {
+        return _owner->NodeToInt(_node);
+    }
+
+    uint64_t JsonView::AsUnsigned() const
+    {
+        return _owner->NodeToUnsigned(_node);
+    }
+
+    double JsonView::AsDouble() const
+    {
+        return _owner->NodeToDouble(_node);
+    }
+
+    bool JsonView::AsBool() const
+    {
+        return _owner->NodeToBool(_node);
+    }
+
+    std::string JsonView::AsString() const
+    {
+        return std::string{_owner->NodeToStringView(_node)};
+    }
+
+    std::string_view JsonView::AsStringView() const
+    {
+        return _owner->NodeToStringView(_node);
+    }
+
+    void JsonView::AsIntArray(std::vector<int64_t>& values) const
+    {
+        values.resize(_owner->NodeArraySize(_node));
+        values.resize(_owner->NodeToIntArray(_node, values.data(), values.size()));
+    }
+
+    std::size_t JsonView::AsIntArray(int64_t* values, std::size_t capacity) const
+    {
+        return _owner->NodeToIntArray(_node, values, capacity);
+    }
+
+    void JsonView::AsUnsignedArray(std::vector<uint64_t>& values) const
+    {
+        values.resize(_owner->NodeArraySize(_node));
+        values.resize(_owner->NodeToUnsignedArray(_node, values.data(), values.size()));
+    }
+
+    std::size_t JsonView::AsUnsignedArray(uint64_t* values, std::size_t capacity) const
+    {
+        return _owner->NodeToUnsignedArray(_node, values, capacity);
+    }
+
+    void JsonView::AsDoubleArray(std::vector<double>& values) const
+    {
+        values.resize(_owner->NodeArraySize(_node));
+        values.resize(_owner->NodeToDoubleArray(_node, values.data(), values.size()));
+    }
+
+    std::size_t JsonView::AsDoubleArray(double* values, std::size_t capacity) const
+    {
+        return _owner->NodeToDoubleArray(_node, values, capacity);
+    }
+
+    bool JsonView::IsNull() const
+    {
+        return _owner->NodeIsNull(_node);
+    }
+
+    bool JsonView::IsObject() const
+    {
+        return _owner->NodeIsObject(_node);
+    }
+
+    bool JsonView::IsArray() const
+    {
+        return _owner->NodeIsArray(_node);
+    }
+
+    std::unique_ptr<IJsonWrapper> JsonView::ToObject() const
+    {
+        return _owner->NodeToObject(_node);
+    }
+
+    std::string JsonView::ToString() const
+    {
+        return _owner->NodeToString(_node);
+    }
+
+    JsonNode JsonView::Node() const
+    {
+        return _node;
+    }
+
+    JsonNode JsonView::Member(std::string_view key) const
+    {
+        return _owner->MemberNode(_node, key);
+    }
+
+}  // namespace Wrappers
@@ -0,0 +1,191 @@
+#include "Interfaces/JsonWriter.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "Details/JsonTextFormat.hpp"
+#include "Exceptions/XJsonError.hpp"
+#include "Interfaces/IJsonSink.hpp"
+#include "Interfaces/IJsonWrapper.hpp"
+
+namespace Wrappers
+{
+    namespace
+    {
+        /**
+         * @brief Nesting reserved up front, so that typical documents don't grow the scope stack.
+         */
+        constexpr std::size_t kReservedDepth = 32;
+
+    }  // namespace
+
+    JsonWriter::JsonWriter(std::string& output) : _output{output}
+    {
+        _scopes.reserve(kReservedDepth);
+    }
+
+    JsonWriter::JsonWriter(char* buffer, std::size_t capacity) : _output{buffer, capacity}
+    {
+        _scopes.reserve(kReservedDepth);
+    }
+
+    JsonWriter::JsonWriter(IJsonSink& sink) : _output{sink}
+    {
+        _scopes.reserve(kReservedDepth);
+    }
+
+    void JsonWriter::BeginObject()
+    {
+        BeginValue();
+        _output.push_back('{');
+        _scopes.push_back(Scope::Object);
+        _first = true;
+    }
+
+    void JsonWriter::EndObject()
+    {
+        if (_scopes.empty() || Scope::Object != _scopes.back() || _afterKey)
+        {
+            throw XJsonError{"No JSON object to end here."};
+        }
+
+        _output.push_back('}');
+        _scopes.pop_back();
+        EndValue();
+    }
+
+    void JsonWriter::BeginArray()
+    {
+        BeginValue();
+        _output.push_back('[');
+        _scopes.push_back(Scope::Array);
+        _first = true;
+    }
+
+    void JsonWriter::EndArray()
+    {
+        if (_scopes.empty() || Scope::Array != _scopes.back())
+        {
+            throw XJsonError{"No JSON array to end here."};
+        }
+
+        _output.push_back(']');
+        _scopes.pop_back();
+        EndValue();
+    }
+
+    void JsonWriter::Key(std::string_view key)
+    {
+        if (_scopes.empty() || Scope::Object != _scopes.back() || _afterKey)
+        {
+            throw XJsonError{"A JSON key is only valid in an object, before each value."};
+        }
+
+        if (!_first)
+        {
+            _output.push_back(',');
+        }
+        _first = false;
+
+        Details::AppendString(_output, key);
+        _output.push_back(':');
+        _afterKey = true;
+    }
+
+    void JsonWriter::Int(int64_t value)
+    {
+        BeginValue();
+        Details::AppendInt(_output, value);
+        EndValue();
+    }
+
+    void JsonWriter::Unsigned(uint64_t value)
+    {
+        BeginValue();
+        Details::AppendUnsigned(_output, value);
+        EndValue();
+    }
+
+    void JsonWriter::Double(double value)
+    {
+        BeginValue();
+        Details::AppendDouble(_output, value);
+        EndValue();
+    }
+
+    void JsonWriter::Bool(bool value)
+    {
+        BeginValue();
+        _output.append(value ? "true" : "false");
+        EndValue();
+    }
+
+    void JsonWriter::String(std::string_view value)
+    {
+        BeginValue();
+        Details::AppendString(_output, value);
+        EndValue();
+    }
+
+    void JsonWriter::Null()
+    {
+        BeginValue();
+        _output.append("null");
+        EndValue();
+    }
+
+    void JsonWriter::Embed(const IJsonWrapper& document)
+    {
+        BeginValue();
+        document.NodeSerialize(document.RootNode(), _output);
+        EndValue();
+    }
+
+    std::size_t JsonWriter::Finish()
+    {
+        if (!_complete)
+        {
+            throw XJsonError{"The JSON document is incomplete."};
+        }
+
+        return _output.Finish();
+    }
+
+    void JsonWriter::BeginValue()
+    {
+        if (_scopes.empty())
+        {
+            if (_complete)
+            {
+                throw XJsonError{"The JSON document is already complete."};
+            }
+            return;
+        }
+
+        if (Scope::Object == _scopes.back())
+        {
+            if (!_afterKey)
+            {
+                throw XJsonError{"A value in a JSON object must follow its key."};
+            }
+            _afterKey = false;
+            return;
+        }
+
+        if (!_first)
+        {
+            _output.push_back(',');
+        }
+        _first = false;
+    }
+
+    void JsonWriter::EndValue()
+    {
+        // a closed array or object is the value of its parent, which is not empty anymore
+        _first = false;
+        _complete = _scopes.empty();
+    }
+
+}  // namespace Wrappers
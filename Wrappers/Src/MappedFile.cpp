@@ -0,0 +1,201 @@
+#include "Details/MappedFile.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define UNIFIED_JSON_WRAPPER_HAS_MMAP 1
+#else
+#include <fstream>
+#endif
+
+#include "Exceptions/XJsonError.hpp"
+
+namespace Wrappers
+{
+    namespace Details
+    {
+#if defined(UNIFIED_JSON_WRAPPER_HAS_MMAP)
+
+        namespace
+        {
+            /**
+             * @brief Closes a file descriptor on scope exit.
+             */
+            class FileDescriptor
+            {
+            public:
+                explicit FileDescriptor(int descriptor) : _descriptor{descriptor}
+                {
+                }
+
+                ~FileDescriptor()
+                {
+                    if (-1 != _descriptor)
+                    {
+                        ::close(_descriptor);
+                    }
+                }
+
+                FileDescriptor(const FileDescriptor&) = delete;
+
+                FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+                int Get() const
+                {
+                    return _descriptor;
+                }
+
+            private:
+                int _descriptor;
+            };
+
+        }  // namespace
+
+        MappedFile::MappedFile(const std::string& filePath, std::size_t padding) : _buffer{}
+        {
+            const FileDescriptor file{::open(filePath.c_str(), O_RDONLY | O_CLOEXEC)};
+
+            struct stat status{};
+            if (-1 == file.Get() || 0 != ::fstat(file.Get(), &status))
+            {
+                throw XJsonError{"Failed to open file: " + filePath};
+            }
+
+            const auto pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+            const auto size = static_cast<std::size_t>(status.st_size);
+            const std::size_t mappedSize = (size + padding + pageSize - 1) / pageSize * pageSize;
+            if (0 == mappedSize)
+            {
+                return;
+            }
+
+            // reserve zeroed anonymous pages for contents plus padding, then lay the file over their start; the
+            // padding thus never runs into pages past the end of the file, which would fault on access
+            void* region = ::mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (MAP_FAILED == region)
+            {
+                throw XJsonError{"Failed to map file: " + filePath};
+            }
+
+            if (0 != size &&
+                MAP_FAILED == ::mmap(region, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, file.Get(), 0))
+            {
+                ::munmap(region, mappedSize);
+                throw XJsonError{"Failed to map file: " + filePath};
+            }
+
+            // parsers read front to back, so let the kernel read ahead aggressively
+            ::madvise(region, mappedSize, MADV_SEQUENTIAL);
+
+            _data = static_cast<char*>(region);
+            _size = size;
+            _mappedSize = mappedSize;
+        }
+
+        void MappedFile::Release()
+        {
+            if (nullptr != _data)
+            {
+                ::munmap(_data, _mappedSize);
+            }
+
+            _data = nullptr;
+            _size = 0;
+            _mappedSize = 0;
+        }
+
+#else
+
+        MappedFile::MappedFile(const std::string& filePath, std::size_t padding) : _buffer{}
+        {
+            std::ifstream file{filePath, std::ios::binary | std::ios::ate};
+            if (!file)
+            {
+                throw XJsonError{"Failed to open file: " + filePath};
+            }
+
+            const auto size = static_cast<std::size_t>(file.tellg());
+            _buffer.assign(size + padding, '\0');
+
+            file.seekg(0);
+            if (!file.read(_buffer.data(), static_cast<std::streamsize>(size)))
+            {
+                throw XJsonError{"Failed to read file: " + filePath};
+            }
+
+            _data = _buffer.data();
+            _size = size;
+            _mappedSize = _buffer.size();
+        }
+
+        void MappedFile::Release()
+        {
+            _buffer.clear();
+            _buffer.shrink_to_fit();
+
+            _data = nullptr;
+            _size = 0;
+            _mappedSize = 0;
+        }
+
+#endif
+
+        MappedFile::~MappedFile()
+        {
+            Release();
+        }
+
+        MappedFile::MappedFile(MappedFile&& other) noexcept
+            : _data{std::exchange(other._data, nullptr)},
+              _size{std::exchange(other._size, 0)},
+              _mappedSize{std::exchange(other._mappedSize, 0)},
+              _buffer{std::move(other._buffer)}
+        {
+            if (!_buffer.empty())
+            {
+                _data = _buffer.data();
+            }
+        }
+
+        MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Release();
+                _data = std::exchange(other._data, nullptr);
+                _size = std::exchange(other._size, 0);
+                _mappedSize = std::exchange(other._mappedSize, 0);
+                _buffer = std::move(other._buffer);
+                if (!_buffer.empty())
+                {
+                    _data = _buffer.data();
+                }
+            }
+
+            return *this;
+        }
+
+        char* MappedFile::Data() const
+        {
+            return _data;
+        }
+
+        std::size_t MappedFile::Size() const
+        {
+            return _size;
+        }
+
+        std::size_t MappedFile::Capacity() const
+        {
+            return _mappedSize;
+        }
+
+    }  // namespace Details
+
+}  // namespace Wrappers
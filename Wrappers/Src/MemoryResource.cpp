@@ -0,0 +1,84 @@
+#include "Details/MemoryResource.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <new>
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        namespace
+        {
+            /**
+             * @brief Header in front of every tagged block. Its alignment keeps the block maximally aligned.
+             */
+            struct alignas(std::max_align_t) Tag
+            {
+                std::pmr::memory_resource* resource;
+                std::size_t size;
+            };
+
+            /**
+             * @brief Bytes in front of a block aligned to `alignment`, the tag last; the tag alone unless over-aligned.
+             */
+            std::size_t HeaderSize(std::size_t alignment) noexcept
+            {
+                return std::max(sizeof(Tag), alignment);
+            }
+
+            /**
+             * @brief The resource bound by the innermost `ResourceScope` of the thread.
+             */
+            thread_local std::pmr::memory_resource* boundResource = nullptr;
+
+        }  // namespace
+
+        std::pmr::memory_resource* CurrentResource()
+        {
+            return (nullptr != boundResource) ? boundResource : std::pmr::get_default_resource();
+        }
+
+        ResourceScope::ResourceScope(std::pmr::memory_resource* resource) : _previous{boundResource}
+        {
+            boundResource = resource;
+        }
+
+        ResourceScope::~ResourceScope()
+        {
+            boundResource = _previous;
+        }
+
+        void* AllocateTagged(std::size_t size, std::pmr::memory_resource* resource, std::size_t alignment)
+        {
+            alignment = std::max(alignment, alignof(Tag));
+            const std::size_t header = HeaderSize(alignment);
+            if (size > std::numeric_limits<std::size_t>::max() - header)
+            {
+                throw std::bad_alloc{};
+            }
+
+            auto* block = static_cast<unsigned char*>(resource->allocate(header + size, alignment));
+            Tag* tag = new (block + header - sizeof(Tag)) Tag{resource, size};
+
+            return tag + 1;
+        }
+
+        void DeallocateTagged(void* memory, std::size_t alignment) noexcept
+        {
+            if (nullptr == memory)
+            {
+                return;
+            }
+
+            alignment = std::max(alignment, alignof(Tag));
+            const std::size_t header = HeaderSize(alignment);
+            const Tag* tag = static_cast<Tag*>(memory) - 1;
+            tag->resource->deallocate(static_cast<unsigned char*>(memory) - header, header + tag->size, alignment);
+        }
+
+    }  // namespace Details
+
+}  // namespace Wrappers
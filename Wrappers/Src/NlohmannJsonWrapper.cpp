@@ -1,177 +1,1468 @@
 #include "Implementations/NlohmannJsonWrapper.hpp"
 
-#include <string>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+#include "Details/JsonMemberSplitter.hpp"
+#include "Details/JsonOutput.hpp"
+#include "Details/MemoryResource.hpp"
+#include "Details/SortedVectorMap.hpp"
 #include "Exceptions/XJsonError.hpp"
+#include "Interfaces/IJsonHandler.hpp"
 #include "Interfaces/IJsonWrapper.hpp"
+#include "Interfaces/JsonBinaryFormat.hpp"
+#include "Interfaces/JsonFeedParser.hpp"
+#include "Interfaces/JsonView.hpp"
+
+namespace Wrappers
+{
+    namespace
+    {
+        template<typename TJson>
+        const TJson* ToJson(JsonNode node)
+        {
+            return static_cast<const TJson*>(node.data);
+        }
+
+        /**
+         * @brief Feeds nlohmann's serializer into a `Details::JsonOutput`.
+         */
+        class OutputAdapter : public nlohmann::detail::output_adapter_protocol<char>
+        {
+        public:
+            explicit OutputAdapter(Details::JsonOutput& output) : _output{output}
+            {
+            }
+
+            void write_character(char character) override
+            {
+                _output.push_back(character);
+            }
+
+            void write_characters(const char* characters, std::size_t length) override
+            {
+                _output.append(std::string_view{characters, length});
+            }
+
+        private:
+            Details::JsonOutput& _output;
+        };
+
+        /**
+         * @brief Pass a value to `handler` as events, members in the order the tree keeps them.
+         */
+        template<typename TJson>
+        void EmitJson(const TJson& json, IJsonHandler& handler)
+        {
+            switch (json.type())
+            {
+                case nlohmann::json::value_t::object:
+                {
+                    handler.BeginObject();
+                    for (const auto& [key, value] : json.template get_ref<const typename TJson::object_t&>())
+                    {
+                        handler.Key(key);
+                        EmitJson(value, handler);
+                    }
+                    handler.EndObject();
+                    break;
+                }
+
+                case nlohmann::json::value_t::array:
+                {
+                    handler.BeginArray();
+                    for (const TJson& element : json)
+                    {
+                        EmitJson(element, handler);
+                    }
+                    handler.EndArray();
+                    break;
+                }
+
+                case nlohmann::json::value_t::number_integer:
+                {
+                    handler.Int(json.template get<int64_t>());
+                    break;
+                }
+
+                case nlohmann::json::value_t::number_unsigned:
+                {
+                    handler.Unsigned(json.template get<uint64_t>());
+                    break;
+                }
+
+                case nlohmann::json::value_t::number_float:
+                {
+                    handler.Double(json.template get<double>());
+                    break;
+                }
+
+                case nlohmann::json::value_t::string:
+                {
+                    handler.String(json.template get_ref<const typename TJson::string_t&>());
+                    break;
+                }
+
+                case nlohmann::json::value_t::boolean:
+                {
+                    handler.Bool(json.template get<bool>());
+                    break;
+                }
+
+                case nlohmann::json::value_t::binary:
+                case nlohmann::json::value_t::discarded:
+                {
+                    throw XJsonError{"Failed to convert JSON object."};
+                }
+
+                case nlohmann::json::value_t::null:
+                default:
+                {
+                    handler.Null();
+                    break;
+                }
+            }
+        }
+
+        /**
+         * @class EventTreeBuilder
+         * @brief Builds a tree from the events of a document of another backend, for `SetObject()`.
+         * @note Allocates from the resource bound to the calling thread; the caller holds a `ResourceScope`.
+         */
+        template<typename TJson>
+        class EventTreeBuilder final : public IJsonHandler
+        {
+        public:
+            /**
+             * @param target Receives the value.
+             */
+            explicit EventTreeBuilder(TJson& target) : _slot{&target}
+            {
+            }
+
+            void BeginObject() override
+            {
+                _containers.push_back(&Place(TJson::object()));
+            }
+
+            void EndObject() override
+            {
+                _containers.pop_back();
+            }
+
+            void BeginArray() override
+            {
+                _containers.push_back(&Place(TJson::array()));
+            }
+
+            void EndArray() override
+            {
+                _containers.pop_back();
+            }
+
+            void Key(std::string_view key) override
+            {
+                _slot = &(*_containers.back())[key];
+            }
+
+            void Int(int64_t value) override
+            {
+                Place(TJson(value));
+            }
+
+            void Unsigned(uint64_t value) override
+            {
+                Place(TJson(value));
+            }
+
+            void Double(double value) override
+            {
+                Place(TJson(value));
+            }
+
+            void Bool(bool value) override
+            {
+                Place(TJson(value));
+            }
+
+            void String(std::string_view value) override
+            {
+                Place(TJson(value));
+            }
+
+            void Null() override
+            {
+                Place(TJson(nullptr));
+            }
+
+        private:
+            /**
+             * @brief Store `value` in the slot of the last key, or append it to the innermost array.
+             */
+            TJson& Place(TJson&& value)
+            {
+                if (nullptr == _slot)
+                {
+                    _containers.back()->push_back(std::move(value));
+                    return _containers.back()->back();
+                }
+
+                TJson& slot = *_slot;
+                slot = std::move(value);
+                _slot = nullptr;
+                return slot;
+            }
+
+            /**
+             * @brief Open arrays and objects, innermost last. Only the innermost one grows, so that the others stay
+             *        put.
+             */
+            std::vector<TJson*> _containers;
+
+            /**
+             * @brief Where the next value goes: the target, then the member of the last key; null within an array.
+             */
+            TJson* _slot;
+        };
+
+        /**
+         * @brief Convert a value with nlohmann's conversion rules.
+         * @throw XJsonError with `errorMessage` if the handle is empty or conversion fails.
+         */
+        template<typename TJson, typename TValue>
+        TValue GetValue(JsonNode node, const char* errorMessage)
+        {
+            const TJson* json = ToJson<TJson>(node);
+            if (nullptr == json)
+            {
+                throw XJsonError{errorMessage};
+            }
+
+            try
+            {
+                return json->template get<TValue>();
+            }
+            catch (const nlohmann::json::exception& e)
+            {
+                throw XJsonError{errorMessage};
+            }
+        }
+
+        /**
+         * @brief Convert a number with nlohmann's conversion rules, without throwing.
+         * @note `get()` converts between every kind of number and throws for anything else.
+         */
+        template<typename TJson, typename TNumber>
+        JsonErrorCode TryGetNumber(JsonNode node, TNumber& value)
+        {
+            const TJson* json = ToJson<TJson>(node);
+            if (nullptr == json || !json->is_number())
+            {
+                return JsonErrorCode::IncorrectType;
+            }
+
+            value = json->template get<TNumber>();
+            return JsonErrorCode::None;
+        }
+
+        /**
+         * @brief Build an array holding a copy of `values`.
+         */
+        template<typename TJson, typename TValue>
+        TJson ToArray(const TValue* values, std::size_t count)
+        {
+            TJson array = TJson::array();
+
+            typename TJson::array_t& elements = array.template get_ref<typename TJson::array_t&>();
+            elements.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                elements.emplace_back(values[i]);
+            }
+
+            return array;
+        }
+
+        /**
+         * @brief Convert every element of an array with nlohmann's conversion rules.
+         * @throw XJsonError with `errorMessage` if the handle is empty, the value is not an array, an element fails
+         *        conversion or the array has more than `capacity` elements.
+         */
+        template<typename TJson, typename TValue>
+        std::size_t GetValues(JsonNode node, TValue* values, std::size_t capacity, const char* errorMessage)
+        {
+            const TJson* json = ToJson<TJson>(node);
+            if (nullptr == json || !json->is_array() || json->size() > capacity)
+            {
+                throw XJsonError{errorMessage};
+            }
+
+            const typename TJson::array_t& elements = json->template get_ref<const typename TJson::array_t&>();
+            try
+            {
+                for (std::size_t i = 0; i < elements.size(); ++i)
+                {
+                    values[i] = elements[i].template get<TValue>();
+                }
+            }
+            catch (const nlohmann::json::exception& e)
+            {
+                throw XJsonError{errorMessage};
+            }
+
+            return elements.size();
+        }
+
+        /**
+         * @brief Index of the first character at or after `position` that is not JSON whitespace.
+         */
+        std::size_t SkipWhitespace(std::string_view text, std::size_t position)
+        {
+            while (position < text.size() && (' ' == text[position] || '\n' == text[position] ||
+                                              '\r' == text[position] || '\t' == text[position]))
+            {
+                ++position;
+            }
+
+            return position;
+        }
+
+        /**
+         * @brief Index just past the string whose opening quote is at `position`.
+         * @param escaped Set if the string contains an escape sequence.
+         * @throw XJsonError If the string is not terminated.
+         */
+        std::size_t SkipString(std::string_view text, std::size_t position, bool& escaped)
+        {
+            for (++position; position < text.size(); ++position)
+            {
+                if ('\\' == text[position])
+                {
+                    escaped = true;
+                    ++position;
+                }
+                else if ('"' == text[position])
+                {
+                    return position + 1;
+                }
+            }
+
+            throw XJsonError{"Failed to parse JSON: unterminated string."};
+        }
+
+        /**
+         * @brief Index just past the value starting at `position`.
+         * @note Only the extent of strings and the nesting of brackets are checked; the value itself is validated
+         *       when it is decoded.
+         * @throw XJsonError If the value is missing, a string is not terminated or brackets don't match.
+         */
+        std::size_t SkipValue(std::string_view text, std::size_t position)
+        {
+            constexpr const char* errorMessage = "Failed to parse JSON: broken structure.";
+
+            if (position >= text.size())
+            {
+                throw XJsonError{errorMessage};
+            }
+
+            bool escaped = false;
+            const char first = text[position];
+            if ('"' == first)
+            {
+                return SkipString(text, position, escaped);
+            }
+
+            if ('{' != first && '[' != first)
+            {
+                // a scalar runs up to the next delimiter
+                const std::size_t end = text.find_first_of(",}] \t\n\r", position);
+                if (end == position)
+                {
+                    throw XJsonError{errorMessage};
+                }
+
+                return (std::string_view::npos == end) ? text.size() : end;
+            }
+
+            std::string closers;
+            while (position < text.size())
+            {
+                const char character = text[position];
+                if ('"' == character)
+                {
+                    position = SkipString(text, position, escaped);
+                    continue;
+                }
+
+                if ('{' == character || '[' == character)
+                {
+                    closers.push_back(('{' == character) ? '}' : ']');
+                }
+                else if ('}' == character || ']' == character)
+                {
+                    if (closers.back() != character)
+                    {
+                        throw XJsonError{errorMessage};
+                    }
+
+                    closers.pop_back();
+                    if (closers.empty())
+                    {
+                        return position + 1;
+                    }
+                }
+
+                ++position;
+            }
+
+            throw XJsonError{errorMessage};
+        }
+
+        /**
+         * @brief Split the top-level object of `text` into keys and value slices, without decoding the values.
+         * @return `false` if `text` is not an object or has a key with escape sequences; such documents are parsed
+         *         eagerly instead.
+         * @throw XJsonError If the structure of the object is broken.
+         */
+        template<typename TMembers>
+        bool IndexMembers(std::string_view text, TMembers& members)
+        {
+            constexpr const char* errorMessage = "Failed to parse JSON: broken structure.";
+
+            std::size_t position = SkipWhitespace(text, 0);
+            if (position == text.size() || '{' != text[position])
+            {
+                return false;
+            }
+
+            position = SkipWhitespace(text, position + 1);
+            if (position < text.size() && '}' == text[position])
+            {
+                ++position;
+            }
+            else
+            {
+                while (true)
+                {
+                    if (position == text.size() || '"' != text[position])
+                    {
+                        throw XJsonError{errorMessage};
+                    }
+
+                    bool escaped = false;
+                    const std::size_t keyEnd = SkipString(text, position, escaped);
+                    if (escaped)
+                    {
+                        return false;
+                    }
+                    const std::string_view key = text.substr(position + 1, keyEnd - position - 2);
+
+                    position = SkipWhitespace(text, keyEnd);
+                    if (position == text.size() || ':' != text[position])
+                    {
+                        throw XJsonError{errorMessage};
+                    }
+
+                    const std::size_t valueStart = SkipWhitespace(text, position + 1);
+                    position = SkipValue(text, valueStart);
+                    members.push_back({key, text.substr(valueStart, position - valueStart)});
+
+                    position = SkipWhitespace(text, position);
+                    if (position < text.size() && ',' == text[position])
+                    {
+                        position = SkipWhitespace(text, position + 1);
+                    }
+                    else if (position < text.size() && '}' == text[position])
+                    {
+                        ++position;
+                        break;
+                    }
+                    else
+                    {
+                        throw XJsonError{errorMessage};
+                    }
+                }
+            }
+
+            if (SkipWhitespace(text, position) != text.size())
+            {
+                throw XJsonError{errorMessage};
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Decode the value of a lazily parsed member.
+         * @throw XJsonError If the value is malformed.
+         */
+        template<typename TJson>
+        TJson DecodeValue(std::string_view value)
+        {
+            try
+            {
+                return TJson::parse(value, nullptr, true);
+            }
+            catch (const nlohmann::json::exception& e)
+            {
+                throw XJsonError{std::string{"Failed to parse JSON: "} + e.what()};
+            }
+        }
+
+        /**
+         * @class TreeBuilder
+         * @brief SAX handler of nlohmann's binary readers that builds a `TJson` tree.
+         * @note The readers don't build with the string type of `TJson`, so they run on `nlohmann::json` and the
+         *       strings they report are copied into the tree here, without an intermediate document.
+         */
+        template<typename TJson>
+        class TreeBuilder
+        {
+        public:
+            explicit TreeBuilder(TJson& result) : _builder{result, false}
+            {
+            }
+
+            bool null()
+            {
+                return _builder.null();
+            }
+
+            bool boolean(bool value)
+            {
+                return _builder.boolean(value);
+            }
+
+            bool number_integer(int64_t value)
+            {
+                return _builder.number_integer(value);
+            }
+
+            bool number_unsigned(uint64_t value)
+            {
+                return _builder.number_unsigned(value);
+            }
+
+            bool number_float(double value, const std::string& /*text*/)
+            {
+                return _builder.number_float(value, typename TJson::string_t{});
+            }
+
+            bool string(std::string& value)
+            {
+                typename TJson::string_t copy{value.data(), value.size()};
+                return _builder.string(copy);
+            }
+
+            bool binary(nlohmann::json::binary_t& /*value*/)
+            {
+                _holdsBinary = true;
+                return false;
+            }
+
+            bool start_object(std::size_t size)
+            {
+                return _builder.start_object(size);
+            }
+
+            bool key(std::string& key)
+            {
+                typename TJson::string_t copy{key.data(), key.size()};
+                return _builder.key(copy);
+            }
+
+            bool end_object()
+            {
+                return _builder.end_object();
+            }
+
+            bool start_array(std::size_t size)
+            {
+                return _builder.start_array(size);
+            }
+
+            bool end_array()
+            {
+                return _builder.end_array();
+            }
+
+            bool parse_error(std::size_t /*position*/,
+                             const std::string& /*token*/,
+                             const nlohmann::detail::exception& /*error*/)
+            {
+                return false;
+            }
+
+            /**
+             * @brief Whether reading stopped at a byte string, which has no JSON counterpart.
+             */
+            bool HoldsBinary() const
+            {
+                return _holdsBinary;
+            }
+
+        private:
+            nlohmann::detail::json_sax_dom_parser<TJson> _builder;
+
+            bool _holdsBinary{false};
+        };
+
+    }  // namespace
+
+    /**
+     * @class BasicNlohmannJsonWrapper::FeedCursor
+     * @brief Parses the top level members and array elements cut by a `Details::JsonMemberSplitter` into the
+     *        document's tree.
+     */
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    class BasicNlohmannJsonWrapper<TObject, TAllocator>::FeedCursor : public IJsonFeedCursor
+    {
+    public:
+        explicit FeedCursor(BasicNlohmannJsonWrapper& document) : _document{&document}, _splitter{true}
+        {
+        }
+
+        void Feed(std::string_view chunk) override
+        {
+            const bool started = _splitter.IsObject() || _splitter.IsArray();
+            const std::vector<Details::JsonMemberSplitter::Member>& members = _splitter.Feed(chunk);
+            if (!started && _splitter.IsObject())
+            {
+                _document->Parse("{}");
+            }
+            else if (!started && _splitter.IsArray())
+            {
+                _document->Parse("[]");
+            }
+
+            const Scope scope{_document->_resource};
+            for (const Details::JsonMemberSplitter::Member& member : members)
+            {
+                Json value;
+                try
+                {
+                    value = Json::parse(member.value, nullptr, true);
+                }
+                catch (const nlohmann::json::exception& e)
+                {
+                    throw XJsonError{"Failed to parse JSON string."};
+                }
+
+                if (_splitter.IsArray())
+                {
+                    _document->_json.push_back(std::move(value));
+                }
+                else if (Details::JsonMemberSplitter::Kind::Element == member.kind)
+                {
+                    _document->_json[member.key].push_back(std::move(value));
+                }
+                else
+                {
+                    _document->_json[member.key] = std::move(value);
+                }
+            }
+        }
+
+        void Finish() override
+        {
+            const std::string_view text = _splitter.Finish();
+            if (!_splitter.IsObject() && !_splitter.IsArray())
+            {
+                _document->Parse(text);
+            }
+        }
+
+    private:
+        BasicNlohmannJsonWrapper* _document;
+        Details::JsonMemberSplitter _splitter;
+    };
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    BasicNlohmannJsonWrapper<TObject, TAllocator>::BasicNlohmannJsonWrapper(std::pmr::memory_resource* resource)
+        : _resource{resource}, _json{}, _lazyMembers{}, _lazyValues{}, _lazyMutex{}
+    {
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    BasicNlohmannJsonWrapper<TObject, TAllocator>::~BasicNlohmannJsonWrapper() = default;
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    BasicNlohmannJsonWrapper<TObject, TAllocator>::BasicNlohmannJsonWrapper(const BasicNlohmannJsonWrapper& other)
+        : IJsonWrapper{}, _resource{other._resource}, _json{}, _lazyMembers{}, _lazyValues{}, _lazyMutex{}
+    {
+        const Json& json = other.DecodedJson();
+        const Scope scope{_resource};
+        _json = json;
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    BasicNlohmannJsonWrapper<TObject, TAllocator>::BasicNlohmannJsonWrapper(BasicNlohmannJsonWrapper&& other) noexcept
+        : IJsonWrapper{},
+          _resource{other._resource},
+          // not braces, which nlohmann takes for an array of one element
+          _json(std::move(other._json)),
+          _lazyMembers{},
+          _lazyValues{},
+          _lazyMutex{}
+    {
+        TakeLazyMembers(other);
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    BasicNlohmannJsonWrapper<TObject, TAllocator>&
+    BasicNlohmannJsonWrapper<TObject, TAllocator>::operator=(const BasicNlohmannJsonWrapper& other)
+    {
+        if (this != &other)
+        {
+            const Json& json = other.DecodedJson();
+            const Scope scope{_resource};
+            Json copy = json;
+            _json = std::move(copy);
+            ForgetLazyMembers();
+        }
+
+        return *this;
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    BasicNlohmannJsonWrapper<TObject, TAllocator>&
+    BasicNlohmannJsonWrapper<TObject, TAllocator>::operator=(BasicNlohmannJsonWrapper&& other) noexcept
+    {
+        if (this != &other)
+        {
+            _json = std::move(other._json);
+            TakeLazyMembers(other);
+        }
+
+        return *this;
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::SetInt(std::string_view key, int64_t value)
+    {
+        const Scope scope{_resource};
+        LeaveLazyMode();
+
+        try
+        {
+            _json[key] = value;
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError{std::string{"Failed to set Integer: "} + e.what()};
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::SetUnsigned(std::string_view key, uint64_t value)
+    {
+        const Scope scope{_resource};
+        LeaveLazyMode();
+
+        try
+        {
+            _json[key] = value;
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError{std::string{"Failed to set Unsigned Integer: "} + e.what()};
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::SetDouble(std::string_view key, double value)
+    {
+        const Scope scope{_resource};
+        LeaveLazyMode();
+
+        try
+        {
+            _json[key] = value;
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError{std::string{"Failed to set Double: "} + e.what()};
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::SetBool(std::string_view key, bool value)
+    {
+        const Scope scope{_resource};
+        LeaveLazyMode();
+
+        try
+        {
+            _json[key] = value;
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError{std::string{"Failed to set Boolean: "} + e.what()};
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::SetString(std::string_view key, std::string_view value)
+    {
+        const Scope scope{_resource};
+        LeaveLazyMode();
+
+        try
+        {
+            _json[key] = value;
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError{std::string{"Failed to set String: "} + e.what()};
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::SetObject(std::string_view key,
+                                                                  std::unique_ptr<IJsonWrapper> jsonObject)
+    {
+        if (nullptr == jsonObject)
+        {
+            throw XJsonError{"Invalid JSON object to set."};
+        }
+
+        if (nullptr == dynamic_cast<BasicNlohmannJsonWrapper*>(jsonObject.get()))
+        {
+            // a child of another backend is converted from its events rather than serialized and parsed again
+            const Scope scope{_resource};
+            Json value;
+            EventTreeBuilder<Json> builder{value};
+            EmitDocument(*jsonObject, builder);
+
+            LeaveLazyMode();
+            try
+            {
+                _json[key] = std::move(value);
+            }
+            catch (const nlohmann::json::exception& e)
+            {
+                throw XJsonError{std::string{"Failed to set Inner Object: "} + e.what()};
+            }
+            return;
+        }
+
+        auto* nlohmannWrapper = static_cast<BasicNlohmannJsonWrapper*>(jsonObject.release());
+        SetNlohmannObject(key, std::unique_ptr<BasicNlohmannJsonWrapper>{nlohmannWrapper});
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::SetNlohmannObject(
+        std::string_view key, std::unique_ptr<BasicNlohmannJsonWrapper> jsonObject)
+    {
+        if (nullptr == jsonObject)
+        {
+            throw XJsonError{"Invalid JSON object to set."};
+        }
+
+        const Scope scope{_resource};
+        jsonObject->LeaveLazyMode();
+        LeaveLazyMode();
+
+        try
+        {
+            // the child is owned by us now, so its tree is stolen rather than copied
+            _json[key] = std::move(jsonObject->_json);
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError{std::string{"Failed to set Inner Object: "} + e.what()};
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::SetNull(std::string_view key)
+    {
+        const Scope scope{_resource};
+        LeaveLazyMode();
+
+        try
+        {
+            _json[key] = nullptr;
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError{std::string{"Failed to set null: "} + e.what()};
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::SetIntArray(std::string_view key,
+                                                                    const int64_t* values,
+                                                                    std::size_t count)
+    {
+        const Scope scope{_resource};
+        LeaveLazyMode();
+
+        try
+        {
+            _json[key] = ToArray<Json>(values, count);
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError{std::string{"Failed to set Integer Array: "} + e.what()};
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::SetUnsignedArray(std::string_view key,
+                                                                         const uint64_t* values,
+                                                                         std::size_t count)
+    {
+        const Scope scope{_resource};
+        LeaveLazyMode();
+
+        try
+        {
+            _json[key] = ToArray<Json>(values, count);
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError{std::string{"Failed to set Unsigned Integer Array: "} + e.what()};
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::SetDoubleArray(std::string_view key,
+                                                                       const double* values,
+                                                                       std::size_t count)
+    {
+        const Scope scope{_resource};
+        LeaveLazyMode();
+
+        try
+        {
+            _json[key] = ToArray<Json>(values, count);
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError{std::string{"Failed to set Double Array: "} + e.what()};
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::SetStringArray(std::string_view key,
+                                                                       const std::string_view* values,
+                                                                       std::size_t count)
+    {
+        const Scope scope{_resource};
+        LeaveLazyMode();
+
+        try
+        {
+            _json[key] = ToArray<Json>(values, count);
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError{std::string{"Failed to set String Array: "} + e.what()};
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    int64_t BasicNlohmannJsonWrapper<TObject, TAllocator>::GetInt(std::string_view key) const
+    {
+        try
+        {
+            return RootMember(key).template get<int64_t>();
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError("Failed to get Integer value.");
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    uint64_t BasicNlohmannJsonWrapper<TObject, TAllocator>::GetUnsigned(std::string_view key) const
+    {
+        try
+        {
+            return RootMember(key).template get<uint64_t>();
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError("Failed to get Unsigned Integer value.");
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    double BasicNlohmannJsonWrapper<TObject, TAllocator>::GetDouble(std::string_view key) const
+    {
+        try
+        {
+            return RootMember(key).template get<double>();
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError("Failed to get Double value.");
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    bool BasicNlohmannJsonWrapper<TObject, TAllocator>::GetBool(std::string_view key) const
+    {
+        try
+        {
+            return RootMember(key).template get<bool>();
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError("Failed to get Boolean value.");
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::string BasicNlohmannJsonWrapper<TObject, TAllocator>::GetString(std::string_view key) const
+    {
+        try
+        {
+            const typename Json::string_t& value = RootMember(key).template get_ref<const typename Json::string_t&>();
+            return std::string{value.data(), value.size()};
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError("Failed to get String value.");
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::string_view BasicNlohmannJsonWrapper<TObject, TAllocator>::GetStringView(std::string_view key) const
+    {
+        try
+        {
+            return RootMember(key).template get_ref<const typename Json::string_t&>();
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError("Failed to get String value.");
+        }
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::unique_ptr<IJsonWrapper> BasicNlohmannJsonWrapper<TObject, TAllocator>::GetObject(std::string_view key) const
+    {
+        const Scope scope{_resource};
+
+        try
+        {
+            std::unique_ptr<BasicNlohmannJsonWrapper> nlohmannWrapper = MakeEmptyNested(_resource);
+
+            if (nullptr == nlohmannWrapper)
+            {
+                throw XJsonError{"Could not allocate for JSON object."};
+            }
+
+            nlohmannWrapper->_json = RootMember(key);
 
-namespace Wrappers
-{
+            return nlohmannWrapper;
+        }
+        catch (const nlohmann::json::exception& e)
+        {
+            throw XJsonError("Failed to get Inner Object.");
+        }
+    }
 
-    void NlohmannJsonWrapper::SetInt(const std::string& key, int64_t value)
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    bool BasicNlohmannJsonWrapper<TObject, TAllocator>::IsNull(std::string_view key) const
     {
         try
         {
-            _json[key] = value;
+            return RootMember(key).is_null();
         }
         catch (const nlohmann::json::exception& e)
         {
-            throw XJsonError{std::string{"Failed to set Integer: "} + e.what()};
+            throw XJsonError{"Failed to check nullability of the value."};
         }
     }
 
-    void NlohmannJsonWrapper::SetUnsigned(const std::string& key, uint64_t value)
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    bool BasicNlohmannJsonWrapper<TObject, TAllocator>::HasKey(std::string_view key) const
     {
-        try
+        if (!IsLazy())
         {
-            _json[key] = value;
+            return _json.contains(key);
         }
-        catch (const nlohmann::json::exception& e)
+
+        for (const LazyMember& member : _lazyMembers)
         {
-            throw XJsonError{std::string{"Failed to set Unsigned Integer: "} + e.what()};
+            if (member.key == key)
+            {
+                return true;
+            }
         }
+
+        return false;
     }
 
-    void NlohmannJsonWrapper::SetDouble(const std::string& key, double value)
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::unique_ptr<IJsonWrapper> BasicNlohmannJsonWrapper<TObject, TAllocator>::GetEmptyObject() const
     {
+        const Scope scope{_resource};
+
         try
         {
-            _json[key] = value;
+            std::unique_ptr<BasicNlohmannJsonWrapper> emptyObject = MakeEmptyNested(_resource);
+            if (nullptr == emptyObject)
+            {
+                throw XJsonError("Could not create an empty JSON object.");
+            }
+
+            emptyObject->_json = Json::object();
+
+            return emptyObject;
         }
         catch (const nlohmann::json::exception& e)
         {
-            throw XJsonError{std::string{"Failed to set Double: "} + e.what()};
+            throw XJsonError{"Failed to create an empty Json object."};
         }
     }
 
-    void NlohmannJsonWrapper::SetBool(const std::string& key, bool value)
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    bool BasicNlohmannJsonWrapper<TObject, TAllocator>::AllowsConcurrentReads() const
+    {
+        return nullptr == _resource;
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::Parse(std::string_view inputJson)
     {
+        const Scope scope{_resource};
+
         try
         {
-            _json[key] = value;
+            // 'nullptr' => no callback.
+            // 'true' => throw exception on bad parse.
+            _json = Json::parse(inputJson, nullptr, true);
         }
         catch (const nlohmann::json::exception& e)
         {
-            throw XJsonError{std::string{"Failed to set Boolean: "} + e.what()};
+            throw XJsonError{"Failed to check nullability of the value."};
         }
+
+        ForgetLazyMembers();
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::ParseLazy(std::string_view inputJson)
+    {
+        const Scope scope{_resource};
+
+        // index the input first, so that a broken document leaves the current one untouched
+        LazyMembers members;
+        if (!IndexMembers(inputJson, members))
+        {
+            Parse(inputJson);
+            return;
+        }
+
+        // the members keep pointing into the caller's text, which outlives lazy mode by contract
+        LazyValues values(members.size());
+        _json = Json::object();
+        _lazyMembers = std::move(members);
+        _lazyValues = std::move(values);
+        _lazyDecoded.store(false, std::memory_order_relaxed);
     }
 
-    void NlohmannJsonWrapper::SetString(const std::string& key, const std::string& value)
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::string BasicNlohmannJsonWrapper<TObject, TAllocator>::ToString() const
     {
+        // `dump()` would build a resource string first
+        std::string text;
+        SerializeTo(text);
+
+        return text;
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::vector<std::uint8_t> BasicNlohmannJsonWrapper<TObject, TAllocator>::ToBinary(JsonBinaryFormat format) const
+    {
+        DecodeAll();
+
         try
         {
-            _json[key] = value;
+            return (JsonBinaryFormat::Cbor == format) ? Json::to_cbor(_json) : Json::to_msgpack(_json);
         }
         catch (const nlohmann::json::exception& e)
         {
-            throw XJsonError{std::string{"Failed to set String: "} + e.what()};
+            throw XJsonError{"Failed to convert JSON object to binary."};
         }
     }
 
-    void NlohmannJsonWrapper::SetObject(const std::string& key, std::unique_ptr<IJsonWrapper> jsonObject)
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::ParseBinary(JsonBinaryFormat format,
+                                                                    const std::uint8_t* bytes,
+                                                                    std::size_t size)
     {
-        try
-        {
-            const NlohmannJsonWrapper* nlohmannWrapper = dynamic_cast<NlohmannJsonWrapper*>(jsonObject.get());
-            if (nullptr == nlohmannWrapper)
-            {
-                throw XJsonError{"Invalid JSON object to set."};
-            }
+        const Scope scope{_resource};
 
-            _json[key] = nlohmannWrapper->_json;
+        if (nullptr == bytes && 0 != size)
+        {
+            throw XJsonError{"Failed to parse binary JSON."};
         }
-        catch (const nlohmann::json::exception& e)
+
+        Json json;
+        TreeBuilder<Json> builder{json};
+        const auto inputFormat = (JsonBinaryFormat::Cbor == format) ? nlohmann::json::input_format_t::cbor
+                                                                    : nlohmann::json::input_format_t::msgpack;
+        if (!nlohmann::json::sax_parse(bytes, bytes + size, &builder, inputFormat))
         {
-            throw XJsonError{std::string{"Failed to set Inner Object: "} + e.what()};
+            throw XJsonError{builder.HoldsBinary()
+                                 ? "Failed to parse binary JSON: byte strings have no JSON counterpart."
+                                 : "Failed to parse binary JSON."};
         }
+
+        _json = std::move(json);
+        ForgetLazyMembers();
     }
 
-    void NlohmannJsonWrapper::SetNull(const std::string& key)
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    JsonNode BasicNlohmannJsonWrapper<TObject, TAllocator>::RootNode() const
     {
-        try
+        return JsonNode{&_json, 0};
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    JsonNode BasicNlohmannJsonWrapper<TObject, TAllocator>::MemberNode(JsonNode object, std::string_view key) const
+    {
+        if (IsLazyRoot(object))
         {
-            _json[key] = nullptr;
+            const Json* member = DecodeMember(key);
+            return (nullptr != member) ? JsonNode{member, 0} : JsonNode{};
         }
-        catch (const nlohmann::json::exception& e)
+
+        const Json* json = ToJson<Json>(object);
+        if (nullptr == json || !json->is_object())
         {
-            throw XJsonError{std::string{"Failed to set null: "} + e.what()};
+            return JsonNode{};
+        }
+
+        const auto member = json->find(key);
+        if (member == json->end())
+        {
+            return JsonNode{};
         }
+
+        return JsonNode{&*member, 0};
     }
 
-    int64_t NlohmannJsonWrapper::GetInt(const std::string& key) const
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    int64_t BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeToInt(JsonNode node) const
     {
-        try
+        return GetValue<Json, int64_t>(node, "Failed to get Integer value.");
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    uint64_t BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeToUnsigned(JsonNode node) const
+    {
+        return GetValue<Json, uint64_t>(node, "Failed to get Unsigned Integer value.");
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    double BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeToDouble(JsonNode node) const
+    {
+        return GetValue<Json, double>(node, "Failed to get Double value.");
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    bool BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeToBool(JsonNode node) const
+    {
+        return GetValue<Json, bool>(node, "Failed to get Boolean value.");
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::string_view BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeToStringView(JsonNode node) const
+    {
+        const Json* json = ToJson<Json>(node);
+        if (nullptr == json || !json->is_string())
         {
-            return _json.at(key).get<int64_t>();
+            throw XJsonError("Failed to get String value.");
         }
-        catch (const nlohmann::json::exception& e)
+
+        return json->template get_ref<const typename Json::string_t&>();
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    JsonErrorCode BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeTryToInt(JsonNode node, int64_t& value) const
+    {
+        return TryGetNumber<Json>(node, value);
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    JsonErrorCode BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeTryToUnsigned(JsonNode node, uint64_t& value) const
+    {
+        return TryGetNumber<Json>(node, value);
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    JsonErrorCode BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeTryToDouble(JsonNode node, double& value) const
+    {
+        return TryGetNumber<Json>(node, value);
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    JsonErrorCode BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeTryToBool(JsonNode node, bool& value) const
+    {
+        const Json* json = ToJson<Json>(node);
+        if (nullptr == json || !json->is_boolean())
         {
-            throw XJsonError("Failed to get Integer value.");
+            return JsonErrorCode::IncorrectType;
         }
+
+        value = json->template get<bool>();
+        return JsonErrorCode::None;
     }
 
-    uint64_t NlohmannJsonWrapper::GetUnsigned(const std::string& key) const
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    JsonErrorCode BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeTryToStringView(JsonNode node,
+                                                                                     std::string_view& value) const
     {
-        try
+        const Json* json = ToJson<Json>(node);
+        if (nullptr == json || !json->is_string())
         {
-            return _json.at(key).get<uint64_t>();
+            return JsonErrorCode::IncorrectType;
         }
-        catch (const nlohmann::json::exception& e)
+
+        value = json->template get_ref<const typename Json::string_t&>();
+        return JsonErrorCode::None;
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    bool BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeIsNull(JsonNode node) const
+    {
+        const Json* json = ToJson<Json>(node);
+        if (nullptr == json)
         {
-            throw XJsonError("Failed to get Unsigned Integer value.");
+            throw XJsonError{"Failed to check nullability of the value."};
         }
+
+        return json->is_null();
     }
 
-    double NlohmannJsonWrapper::GetDouble(const std::string& key) const
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    bool BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeIsObject(JsonNode node) const
     {
-        try
+        const Json* json = ToJson<Json>(node);
+        return nullptr != json && json->is_object();
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    bool BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeIsArray(JsonNode node) const
+    {
+        const Json* json = ToJson<Json>(node);
+        return nullptr != json && json->is_array();
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::size_t BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeArraySize(JsonNode node) const
+    {
+        if (!NodeIsArray(node))
         {
-            return _json.at(key).get<double>();
+            throw XJsonError("Failed to get Array.");
         }
-        catch (const nlohmann::json::exception& e)
+
+        return ToJson<Json>(node)->size();
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    JsonNode BasicNlohmannJsonWrapper<TObject, TAllocator>::ElementNode(JsonNode array, std::size_t index) const
+    {
+        if (!NodeIsArray(array) || index >= ToJson<Json>(array)->size())
         {
-            throw XJsonError("Failed to get Double value.");
+            return JsonNode{};
         }
+
+        return JsonNode{&(*ToJson<Json>(array))[index], 0};
     }
 
-    bool NlohmannJsonWrapper::GetBool(const std::string& key) const
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeForEachMember(JsonNode object,
+                                                                          IJsonMemberVisitor& visitor) const
     {
-        try
+        if (IsLazyRoot(object))
         {
-            return _json.at(key).get<bool>();
+            DecodeAll();
         }
-        catch (const nlohmann::json::exception& e)
+
+        const Json* json = ToJson<Json>(object);
+        if (nullptr == json || !json->is_object())
         {
-            throw XJsonError("Failed to get Boolean value.");
+            throw XJsonError("Failed to get Inner Object.");
+        }
+
+        for (const auto& [key, value] : json->template get_ref<const typename Json::object_t&>())
+        {
+            visitor.Visit(key, JsonView{*this, JsonNode{&value, 0}});
         }
     }
 
-    std::string NlohmannJsonWrapper::GetString(const std::string& key) const
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::size_t BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeToIntArray(JsonNode node,
+                                                                              int64_t* values,
+                                                                              std::size_t capacity) const
     {
-        try
+        return GetValues<Json>(node, values, capacity, "Failed to get Integer Array.");
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::size_t BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeToUnsignedArray(JsonNode node,
+                                                                                   uint64_t* values,
+                                                                                   std::size_t capacity) const
+    {
+        return GetValues<Json>(node, values, capacity, "Failed to get Unsigned Integer Array.");
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::size_t BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeToDoubleArray(JsonNode node,
+                                                                                 double* values,
+                                                                                 std::size_t capacity) const
+    {
+        return GetValues<Json>(node, values, capacity, "Failed to get Double Array.");
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::unique_ptr<IJsonWrapper> BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeToObject(JsonNode node) const
+    {
+        if (IsLazyRoot(node))
         {
-            return _json.at(key).get<std::string>();
+            DecodeAll();
         }
-        catch (const nlohmann::json::exception& e)
+
+        const Json* json = ToJson<Json>(node);
+        if (nullptr == json)
         {
-            throw XJsonError("Failed to get String value.");
+            throw XJsonError("Failed to get Inner Object.");
         }
+
+        const Scope scope{_resource};
+
+        std::unique_ptr<BasicNlohmannJsonWrapper> nlohmannWrapper = MakeEmptyNested(_resource);
+        nlohmannWrapper->_json = *json;
+
+        return nlohmannWrapper;
     }
 
-    std::unique_ptr<IJsonWrapper> NlohmannJsonWrapper::GetObject(const std::string& key) const
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::unique_ptr<IJsonWrapper> BasicNlohmannJsonWrapper<TObject, TAllocator>::DetachObject(std::string_view key)
     {
+        LeaveLazyMode();
+
         try
         {
-            std::unique_ptr<NlohmannJsonWrapper> nlohmannWrapper = std::make_unique<NlohmannJsonWrapper>();
-
-            if (nullptr == nlohmannWrapper)
-            {
-                throw XJsonError{"Could not allocate for JSON object."};
-            }
-
-            nlohmannWrapper->_json = _json.at(key).get<nlohmann::json>();
+            std::unique_ptr<BasicNlohmannJsonWrapper> nlohmannWrapper = MakeEmptyNested(_resource);
+            nlohmannWrapper->_json = std::move(_json.at(key));
 
             return nlohmannWrapper;
         }
@@ -181,67 +1472,231 @@ namespace Wrappers
         }
     }
 
-    bool NlohmannJsonWrapper::IsNull(const std::string& key) const
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::unique_ptr<IJsonFeedCursor> BasicNlohmannJsonWrapper<TObject, TAllocator>::OpenFeed()
+    {
+        return std::make_unique<FeedCursor>(*this);
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::string BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeToString(JsonNode node) const
+    {
+        const Json* json = ToJson<Json>(node);
+        if (nullptr == json)
+        {
+            throw XJsonError{"Failed to convert JSON object to String."};
+        }
+
+        std::string text;
+        {
+            Details::JsonOutput output{text};
+            NodeSerialize(node, output);
+            output.Finish();
+        }
+
+        return text;
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeSerialize(JsonNode node, Details::JsonOutput& output) const
     {
+        if (IsLazyRoot(node))
+        {
+            DecodeAll();
+        }
+
+        const Json* json = ToJson<Json>(node);
+        if (nullptr == json)
+        {
+            throw XJsonError{"Failed to convert JSON object to String."};
+        }
+
         try
         {
-            return _json.at(key).is_null();
+            // `dump()` without its string; the adapter is borrowed through an aliasing, non-owning pointer
+            OutputAdapter adapter{output};
+            nlohmann::detail::serializer<Json> serializer{
+                nlohmann::detail::output_adapter_t<char>{std::shared_ptr<void>{}, &adapter}, ' '};
+            serializer.dump(*json, false, false, 0);
         }
         catch (const nlohmann::json::exception& e)
         {
-            throw XJsonError{"Failed to check nullability of the value."};
+            throw XJsonError{"Failed to convert JSON object to String. Verify if it's UTF-8 encoded."};
         }
     }
 
-    bool NlohmannJsonWrapper::HasKey(const std::string& key) const
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::NodeEmit(JsonNode node, IJsonHandler& handler) const
     {
-        return _json.contains(key);
+        if (IsLazyRoot(node))
+        {
+            DecodeAll();
+        }
+
+        const Json* json = ToJson<Json>(node);
+        if (nullptr == json)
+        {
+            throw XJsonError{"Failed to convert JSON object."};
+        }
+
+        EmitJson(*json, handler);
     }
 
-    std::unique_ptr<IJsonWrapper> NlohmannJsonWrapper::GetEmptyObject() const
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    const typename BasicNlohmannJsonWrapper<TObject, TAllocator>::Json&
+    BasicNlohmannJsonWrapper<TObject, TAllocator>::RootMember(std::string_view key) const
     {
-        try
+        if (!IsLazy())
         {
-            std::unique_ptr<NlohmannJsonWrapper> emptyObject = std::make_unique<NlohmannJsonWrapper>();
-            if (nullptr == emptyObject)
+            return _json.at(key);
+        }
+
+        const Json* member = DecodeMember(key);
+        if (nullptr == member)
+        {
+            throw nlohmann::json::out_of_range::create(403, "key '" + std::string{key} + "' not found", nullptr);
+        }
+
+        return *member;
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    const typename BasicNlohmannJsonWrapper<TObject, TAllocator>::Json*
+    BasicNlohmannJsonWrapper<TObject, TAllocator>::DecodeMember(std::string_view key) const
+    {
+        // the last of several equal keys wins, as in `Parse()`
+        for (std::size_t index = _lazyMembers.size(); 0 != index; --index)
+        {
+            const LazyMember& member = _lazyMembers[index - 1];
+            if (member.key != key)
             {
-                throw XJsonError("Could not create an empty JSON object.");
+                continue;
             }
 
-            emptyObject->_json = nlohmann::json::object();
+            LazyValue& value = _lazyValues[index - 1];
+            if (!value.decoded.load(std::memory_order_acquire))
+            {
+                const std::lock_guard lock{_lazyMutex};
+                if (!value.decoded.load(std::memory_order_relaxed))
+                {
+                    const Scope scope{_resource};
+                    value.json = DecodeValue<Json>(member.value);
+                    value.decoded.store(true, std::memory_order_release);
+                }
+            }
 
-            return emptyObject;
-        }
-        catch (const nlohmann::json::exception& e)
-        {
-            throw XJsonError{"Failed to create an empty Json object."};
+            return &value.json;
         }
+
+        return nullptr;
     }
 
-    void NlohmannJsonWrapper::Parse(const std::string& inputJson)
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::DecodeAll() const
     {
-        try
+        if (!IsLazy())
         {
-            // 'nullptr' => no callback.
-            // 'true' => throw exception on bad parse.
-            _json = nlohmann::json::parse(inputJson, nullptr, true);
+            return;
         }
-        catch (const nlohmann::json::exception& e)
+
+        const std::lock_guard lock{_lazyMutex};
+        if (_lazyDecoded.load(std::memory_order_relaxed))
         {
-            throw XJsonError{"Failed to check nullability of the value."};
+            return;
         }
-    }
 
-    std::string NlohmannJsonWrapper::ToString() const
-    {
-        try
+        const Scope scope{_resource};
+
+        // into the empty object already there, whose type other readers may be checking; in document order, so that
+        // the last of several equal keys wins. Members read so far are decoded again, as they may be read meanwhile
+        for (const LazyMember& member : _lazyMembers)
         {
-            return _json.dump();
+            _json[member.key] = DecodeValue<Json>(member.value);
         }
-        catch (const nlohmann::json::exception& e)
+
+        _lazyDecoded.store(true, std::memory_order_release);
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    const typename BasicNlohmannJsonWrapper<TObject, TAllocator>::Json&
+    BasicNlohmannJsonWrapper<TObject, TAllocator>::DecodedJson() const
+    {
+        DecodeAll();
+
+        return _json;
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::TakeLazyMembers(BasicNlohmannJsonWrapper& other) noexcept
+    {
+        // moving the vectors keeps the decoded values where they are
+        _lazyMembers = std::move(other._lazyMembers);
+        _lazyValues = std::move(other._lazyValues);
+        _lazyDecoded.store(other._lazyDecoded.load(std::memory_order_acquire), std::memory_order_relaxed);
+        other.ForgetLazyMembers();
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::LeaveLazyMode()
+    {
+        if (_lazyMembers.empty())
         {
-            throw XJsonError{"Failed to convert JSON object to String. Verify if it's UTF-8 encoded."};
+            return;
         }
+
+        DecodeAll();
+        ForgetLazyMembers();
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    void BasicNlohmannJsonWrapper<TObject, TAllocator>::ForgetLazyMembers()
+    {
+        _lazyMembers.clear();
+        _lazyValues.clear();
+        _lazyDecoded.store(false, std::memory_order_relaxed);
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    bool BasicNlohmannJsonWrapper<TObject, TAllocator>::IsLazy() const
+    {
+        return !_lazyMembers.empty() && !_lazyDecoded.load(std::memory_order_acquire);
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    bool BasicNlohmannJsonWrapper<TObject, TAllocator>::IsLazyRoot(JsonNode node) const
+    {
+        return IsLazy() && ToJson<Json>(node) == &_json;
+    }
+
+    template<template<typename, typename, typename...> class TObject, template<typename> class TAllocator>
+    std::unique_ptr<BasicNlohmannJsonWrapper<TObject, TAllocator>> BasicNlohmannJsonWrapper<TObject, TAllocator>::
+        MakeEmptyNested(std::pmr::memory_resource* resource) const
+    {
+        return MakeNested<BasicNlohmannJsonWrapper>(resource, resource);
+    }
+
+    template class BasicNlohmannJsonWrapper<std::map>;
+
+    template class BasicNlohmannJsonWrapper<Details::SortedVectorMap>;
+
+    template class BasicNlohmannJsonWrapper<std::map, Details::ResourceAllocator>;
+
+    std::unique_ptr<NlohmannJsonWrapper::BasicNlohmannJsonWrapper> NlohmannJsonWrapper::MakeEmptyNested(
+        std::pmr::memory_resource* resource) const
+    {
+        return MakeNested<NlohmannJsonWrapper>(resource, resource);
+    }
+
+    std::unique_ptr<NlohmannFlatJsonWrapper::BasicNlohmannJsonWrapper> NlohmannFlatJsonWrapper::MakeEmptyNested(
+        std::pmr::memory_resource* resource) const
+    {
+        return MakeNested<NlohmannFlatJsonWrapper>(resource, resource);
+    }
+
+    std::unique_ptr<NlohmannPmrJsonWrapper::BasicNlohmannJsonWrapper> NlohmannPmrJsonWrapper::MakeEmptyNested(
+        std::pmr::memory_resource* resource) const
+    {
+        return MakeNested<NlohmannPmrJsonWrapper>(resource, resource);
     }
 
 }  // namespace Wrappers
@@ -0,0 +1,253 @@
+#include "Details/Parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace Wrappers
+{
+    namespace Details
+    {
+        namespace
+        {
+            /**
+             * @class HelperPool
+             * @brief Threads kept between the calls of `RunParallel()`, so that a call doesn't start and join its
+             *        helpers again.
+             * @note One call uses the pool at a time; `TryRun()` declines while another one does, e.g. a task that
+             *       runs in parallel itself, and that call starts threads of its own.
+             */
+            class HelperPool
+            {
+            public:
+                HelperPool() = default;
+                HelperPool(const HelperPool&) = delete;
+                HelperPool& operator=(const HelperPool&) = delete;
+
+                ~HelperPool()
+                {
+                    {
+                        const std::lock_guard<std::mutex> lock{_mutex};
+                        _stopping = true;
+                    }
+                    _wake.notify_all();
+                    for (std::thread& helper : _helpers)
+                    {
+                        helper.join();
+                    }
+                }
+
+                /**
+                 * @brief Run `work` on the calling thread and on up to `helperCount` helpers, until all returned.
+                 * @return False, without running `work`, if another call is using the pool.
+                 * @note `work` must not throw.
+                 */
+                bool TryRun(const std::function<void()>& work, std::size_t helperCount)
+                {
+                    std::unique_lock<std::mutex> user{_userMutex, std::try_to_lock};
+                    if (!user.owns_lock())
+                    {
+                        return false;
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock{_mutex};
+                        while (_helpers.size() < helperCount)
+                        {
+                            try
+                            {
+                                _helpers.emplace_back([this] { Serve(); });
+                            }
+                            catch (const std::system_error&)
+                            {
+                                // the helpers running take over the share of the missing ones
+                                break;
+                            }
+                        }
+
+                        _work = &work;
+                        _wanted = std::min(helperCount, _helpers.size());
+                        _claimed = 0;
+                        ++_generation;
+                    }
+                    _wake.notify_all();
+
+                    work();
+
+                    // helpers that didn't wake up yet would find nothing left to do
+                    std::unique_lock<std::mutex> lock{_mutex};
+                    _wanted = _claimed;
+                    _done.wait(lock, [this] { return 0 == _running; });
+                    _work = nullptr;
+
+                    return true;
+                }
+
+            private:
+                /**
+                 * @brief Body of a helper: wait for a call and join it while it wants more helpers.
+                 */
+                void Serve()
+                {
+                    std::size_t seen = 0;
+                    std::unique_lock<std::mutex> lock{_mutex};
+                    while (true)
+                    {
+                        _wake.wait(lock, [&] { return _stopping || seen != _generation; });
+                        if (_stopping)
+                        {
+                            return;
+                        }
+
+                        seen = _generation;
+                        if (_claimed >= _wanted)
+                        {
+                            continue;
+                        }
+
+                        ++_claimed;
+                        ++_running;
+                        const std::function<void()>& work = *_work;
+                        lock.unlock();
+                        work();
+                        lock.lock();
+                        if (0 == --_running)
+                        {
+                            _done.notify_one();
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Held by the call using the pool.
+                 */
+                std::mutex _userMutex;
+
+                /**
+                 * @brief Guards the members below.
+                 */
+                std::mutex _mutex;
+
+                /**
+                 * @brief Signals the helpers a new call or the end of the pool.
+                 */
+                std::condition_variable _wake;
+
+                /**
+                 * @brief Signals the calling thread that the last helper finished.
+                 */
+                std::condition_variable _done;
+
+                std::vector<std::thread> _helpers;
+
+                /**
+                 * @brief The work of the current call.
+                 */
+                const std::function<void()>* _work{nullptr};
+
+                /**
+                 * @brief Helpers the current call wants, helpers that joined it and helpers still running it.
+                 */
+                std::size_t _wanted{0};
+                std::size_t _claimed{0};
+                std::size_t _running{0};
+
+                /**
+                 * @brief Counts the calls, so that a helper joins each one at most once.
+                 */
+                std::size_t _generation{0};
+                bool _stopping{false};
+            };
+
+            HelperPool& Helpers()
+            {
+                static HelperPool pool;
+                return pool;
+            }
+
+        }  // namespace
+
+        void RunParallel(std::size_t count, std::size_t threadCount, const std::function<void(std::size_t)>& task)
+        {
+            if (0 == threadCount)
+            {
+                threadCount = std::thread::hardware_concurrency();
+            }
+            threadCount = std::clamp<std::size_t>(threadCount, 1, std::max<std::size_t>(count, 1));
+
+            std::atomic<std::size_t> next{0};
+            std::atomic<bool> failed{false};
+            std::mutex errorMutex;
+            std::size_t errorIndex = count;
+            std::exception_ptr error;
+
+            const std::function<void()> work = [&]() {
+                while (!failed.load(std::memory_order_relaxed))
+                {
+                    const std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+                    if (index >= count)
+                    {
+                        return;
+                    }
+
+                    try
+                    {
+                        task(index);
+                    }
+                    catch (...)
+                    {
+                        const std::lock_guard<std::mutex> lock{errorMutex};
+                        if (index < errorIndex)
+                        {
+                            errorIndex = index;
+                            error = std::current_exception();
+                        }
+                        failed.store(true, std::memory_order_relaxed);
+                        return;
+                    }
+                }
+            };
+
+            if (1 == threadCount)
+            {
+                work();
+            }
+            else if (!Helpers().TryRun(work, threadCount - 1))
+            {
+                std::vector<std::thread> helpers;
+                helpers.reserve(threadCount - 1);
+                for (std::size_t i = 1; i < threadCount; ++i)
+                {
+                    try
+                    {
+                        helpers.emplace_back(work);
+                    }
+                    catch (const std::system_error&)
+                    {
+                        break;
+                    }
+                }
+
+                work();
+                for (std::thread& helper : helpers)
+                {
+                    helper.join();
+                }
+            }
+
+            if (nullptr != error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+    }  // namespace Details
+
+}  // namespace Wrappers
@@ -0,0 +1,2079 @@
+#include "Implementations/SimdJsonWrapper.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <simdjson.h>
+
+#include "Details/JsonMemberSplitter.hpp"
+#include "Details/JsonOutput.hpp"
+#include "Details/JsonTextFormat.hpp"
+#include "Details/MappedFile.hpp"
+#include "Exceptions/XJsonError.hpp"
+#include "Interfaces/IJsonHandler.hpp"
+#include "Interfaces/IJsonWrapper.hpp"
+#include "Interfaces/JsonFeedParser.hpp"
+#include "Interfaces/JsonKey.hpp"
+#include "Interfaces/JsonStream.hpp"
+#include "Interfaces/JsonView.hpp"
+#include "Interfaces/JsonWriter.hpp"
+
+namespace Wrappers
+{
+    namespace
+    {
+        /**
+         * @brief Serialize a value in the same canonical form as `NlohmannJsonWrapper::ToString()`.
+         * @note Object members are emitted sorted by key; for duplicate keys the last one wins.
+         * @tparam TOutput `std::string` or `Details::JsonOutput`.
+         * @tparam TValue `simdjson::ondemand::document` or `simdjson::ondemand::value`.
+         */
+        template<typename TOutput, typename TValue>
+        simdjson::error_code WriteCanonical(TOutput& out, TValue& value)
+        {
+            simdjson::ondemand::json_type type{};
+            simdjson::error_code error = value.type().get(type);
+            if (simdjson::SUCCESS != error)
+            {
+                return error;
+            }
+
+            switch (type)
+            {
+                case simdjson::ondemand::json_type::object:
+                {
+                    simdjson::ondemand::object object;
+                    if (simdjson::SUCCESS != (error = value.get_object().get(object)))
+                    {
+                        return error;
+                    }
+
+                    // keys point into the parser's string buffer, which stays valid for the whole traversal
+                    std::vector<std::pair<std::string_view, std::string>> members;
+                    for (auto result : object)
+                    {
+                        simdjson::ondemand::field field;
+                        std::string_view key;
+                        std::string member;
+                        if (simdjson::SUCCESS != (error = std::move(result).get(field)) ||
+                            simdjson::SUCCESS != (error = field.unescaped_key().get(key)) ||
+                            simdjson::SUCCESS != (error = WriteCanonical(member, field.value())))
+                        {
+                            return error;
+                        }
+                        members.emplace_back(key, std::move(member));
+                    }
+
+                    std::stable_sort(members.begin(), members.end(), [](const auto& lhs, const auto& rhs) {
+                        return lhs.first < rhs.first;
+                    });
+
+                    out.push_back('{');
+                    bool first = true;
+                    for (std::size_t i = 0; i < members.size(); ++i)
+                    {
+                        if (i + 1 < members.size() && members[i + 1].first == members[i].first)
+                        {
+                            continue;
+                        }
+
+                        if (!first)
+                        {
+                            out.push_back(',');
+                        }
+                        first = false;
+
+                        Details::AppendString(out, members[i].first);
+                        out.push_back(':');
+                        out.append(members[i].second);
+                    }
+                    out.push_back('}');
+                    return simdjson::SUCCESS;
+                }
+
+                case simdjson::ondemand::json_type::array:
+                {
+                    simdjson::ondemand::array array;
+                    if (simdjson::SUCCESS != (error = value.get_array().get(array)))
+                    {
+                        return error;
+                    }
+
+                    out.push_back('[');
+                    bool first = true;
+                    for (auto result : array)
+                    {
+                        simdjson::ondemand::value element;
+                        if (simdjson::SUCCESS != (error = std::move(result).get(element)))
+                        {
+                            return error;
+                        }
+
+                        if (!first)
+                        {
+                            out.push_back(',');
+                        }
+                        first = false;
+
+                        if (simdjson::SUCCESS != (error = WriteCanonical(out, element)))
+                        {
+                            return error;
+                        }
+                    }
+                    out.push_back(']');
+                    return simdjson::SUCCESS;
+                }
+
+                case simdjson::ondemand::json_type::number:
+                {
+                    simdjson::ondemand::number_type numberType{};
+                    if (simdjson::SUCCESS != (error = value.get_number_type().get(numberType)))
+                    {
+                        return error;
+                    }
+
+                    switch (numberType)
+                    {
+                        case simdjson::ondemand::number_type::signed_integer:
+                        {
+                            int64_t number = 0;
+                            error = value.get_int64().get(number);
+                            Details::AppendInt(out, number);
+                            return error;
+                        }
+
+                        case simdjson::ondemand::number_type::unsigned_integer:
+                        {
+                            uint64_t number = 0;
+                            error = value.get_uint64().get(number);
+                            Details::AppendUnsigned(out, number);
+                            return error;
+                        }
+
+                        case simdjson::ondemand::number_type::floating_point_number:
+                        case simdjson::ondemand::number_type::big_integer:
+                        default:
+                        {
+                            // integers beyond 64 bits are kept as doubles, like nlohmann does
+                            double number = 0;
+                            error = value.get_double().get(number);
+                            Details::AppendDouble(out, number);
+                            return error;
+                        }
+                    }
+                }
+
+                case simdjson::ondemand::json_type::string:
+                {
+                    std::string_view text;
+                    if (simdjson::SUCCESS != (error = value.get_string().get(text)))
+                    {
+                        return error;
+                    }
+
+                    Details::AppendString(out, text);
+                    return simdjson::SUCCESS;
+                }
+
+                case simdjson::ondemand::json_type::boolean:
+                {
+                    bool boolean = false;
+                    if (simdjson::SUCCESS != (error = value.get_bool().get(boolean)))
+                    {
+                        return error;
+                    }
+
+                    out.append(boolean ? "true" : "false");
+                    return simdjson::SUCCESS;
+                }
+
+                case simdjson::ondemand::json_type::null:
+                default:
+                {
+                    bool isNull = false;
+                    if (simdjson::SUCCESS != (error = value.is_null().get(isNull)) || !isNull)
+                    {
+                        return simdjson::SUCCESS != error ? error : simdjson::N_ATOM_ERROR;
+                    }
+
+                    out.append("null");
+                    return simdjson::SUCCESS;
+                }
+            }
+        }
+
+        /**
+         * @brief Pass a value to `handler` as events, members in document order.
+         * @note Keys and strings are unescaped into the parser's string buffer, which stays valid for the whole
+         *       traversal.
+         */
+        template<typename TValue>
+        simdjson::error_code EmitValue(TValue& value, IJsonHandler& handler)
+        {
+            simdjson::ondemand::json_type type{};
+            simdjson::error_code error = value.type().get(type);
+            if (simdjson::SUCCESS != error)
+            {
+                return error;
+            }
+
+            switch (type)
+            {
+                case simdjson::ondemand::json_type::object:
+                {
+                    simdjson::ondemand::object object;
+                    if (simdjson::SUCCESS != (error = value.get_object().get(object)))
+                    {
+                        return error;
+                    }
+
+                    handler.BeginObject();
+                    for (auto result : object)
+                    {
+                        simdjson::ondemand::field field;
+                        std::string_view key;
+                        if (simdjson::SUCCESS != (error = std::move(result).get(field)) ||
+                            simdjson::SUCCESS != (error = field.unescaped_key().get(key)))
+                        {
+                            return error;
+                        }
+
+                        handler.Key(key);
+                        if (simdjson::SUCCESS != (error = EmitValue(field.value(), handler)))
+                        {
+                            return error;
+                        }
+                    }
+                    handler.EndObject();
+                    return simdjson::SUCCESS;
+                }
+
+                case simdjson::ondemand::json_type::array:
+                {
+                    simdjson::ondemand::array array;
+                    if (simdjson::SUCCESS != (error = value.get_array().get(array)))
+                    {
+                        return error;
+                    }
+
+                    handler.BeginArray();
+                    for (auto result : array)
+                    {
+                        simdjson::ondemand::value element;
+                        if (simdjson::SUCCESS != (error = std::move(result).get(element)) ||
+                            simdjson::SUCCESS != (error = EmitValue(element, handler)))
+                        {
+                            return error;
+                        }
+                    }
+                    handler.EndArray();
+                    return simdjson::SUCCESS;
+                }
+
+                case simdjson::ondemand::json_type::number:
+                {
+                    simdjson::ondemand::number_type numberType{};
+                    if (simdjson::SUCCESS != (error = value.get_number_type().get(numberType)))
+                    {
+                        return error;
+                    }
+
+                    switch (numberType)
+                    {
+                        case simdjson::ondemand::number_type::signed_integer:
+                        {
+                            int64_t number = 0;
+                            if (simdjson::SUCCESS == (error = value.get_int64().get(number)))
+                            {
+                                handler.Int(number);
+                            }
+                            return error;
+                        }
+
+                        case simdjson::ondemand::number_type::unsigned_integer:
+                        {
+                            uint64_t number = 0;
+                            if (simdjson::SUCCESS == (error = value.get_uint64().get(number)))
+                            {
+                                handler.Unsigned(number);
+                            }
+                            return error;
+                        }
+
+                        case simdjson::ondemand::number_type::floating_point_number:
+                        case simdjson::ondemand::number_type::big_integer:
+                        default:
+                        {
+                            double number = 0;
+                            if (simdjson::SUCCESS == (error = value.get_double().get(number)))
+                            {
+                                handler.Double(number);
+                            }
+                            return error;
+                        }
+                    }
+                }
+
+                case simdjson::ondemand::json_type::string:
+                {
+                    std::string_view text;
+                    if (simdjson::SUCCESS != (error = value.get_string().get(text)))
+                    {
+                        return error;
+                    }
+
+                    handler.String(text);
+                    return simdjson::SUCCESS;
+                }
+
+                case simdjson::ondemand::json_type::boolean:
+                {
+                    bool boolean = false;
+                    if (simdjson::SUCCESS != (error = value.get_bool().get(boolean)))
+                    {
+                        return error;
+                    }
+
+                    handler.Bool(boolean);
+                    return simdjson::SUCCESS;
+                }
+
+                case simdjson::ondemand::json_type::null:
+                default:
+                {
+                    bool isNull = false;
+                    if (simdjson::SUCCESS != (error = value.is_null().get(isNull)) || !isNull)
+                    {
+                        return simdjson::SUCCESS != error ? error : simdjson::N_ATOM_ERROR;
+                    }
+
+                    handler.Null();
+                    return simdjson::SUCCESS;
+                }
+            }
+        }
+
+        /**
+         * @brief Whether `text` is a JSON number: an optional minus, an integer without leading zeros, then an
+         *        optional fraction and exponent.
+         */
+        bool IsNumber(std::string_view text)
+        {
+            std::size_t position = 0;
+            const auto skip = [&](char character) {
+                const bool found = position < text.size() && character == text[position];
+                position += found ? 1 : 0;
+                return found;
+            };
+            const auto digits = [&]() {
+                const std::size_t begin = position;
+                while (position < text.size() && '0' <= text[position] && '9' >= text[position])
+                {
+                    ++position;
+                }
+                return position != begin;
+            };
+
+            skip('-');
+            if (!skip('0') && !digits())
+            {
+                return false;
+            }
+            if (skip('.') && !digits())
+            {
+                return false;
+            }
+            if (skip('e') || skip('E'))
+            {
+                if (!skip('+'))
+                {
+                    skip('-');
+                }
+                if (!digits())
+                {
+                    return false;
+                }
+            }
+
+            return position == text.size();
+        }
+
+        /**
+         * @brief Check the token of a scalar: a number, or an atom spelled out in full. Strings are delimited by
+         *        stage 1 and their escapes checked by `CheckEscapes()`.
+         * @param token The raw token, which may end with whitespace.
+         */
+        simdjson::error_code CheckScalar(std::string_view token)
+        {
+            const std::size_t last = token.find_last_not_of(" \t\n\r");
+            token = token.substr(0, (std::string_view::npos == last) ? 0 : last + 1);
+            if (token.empty())
+            {
+                return simdjson::TAPE_ERROR;
+            }
+
+            switch (token.front())
+            {
+                case '"':
+                    return simdjson::SUCCESS;
+                case 't':
+                    return ("true" == token) ? simdjson::SUCCESS : simdjson::T_ATOM_ERROR;
+                case 'f':
+                    return ("false" == token) ? simdjson::SUCCESS : simdjson::F_ATOM_ERROR;
+                case 'n':
+                    return ("null" == token) ? simdjson::SUCCESS : simdjson::N_ATOM_ERROR;
+                default:
+                    return IsNumber(token) ? simdjson::SUCCESS : simdjson::NUMBER_ERROR;
+            }
+        }
+
+        /**
+         * @brief The raw token of a nested value, up to the next structural character.
+         */
+        std::string_view RawToken(simdjson::ondemand::value& value)
+        {
+            return value.raw_json_token();
+        }
+
+        /**
+         * @brief The raw token of a document, empty if it can't be read.
+         */
+        std::string_view RawToken(simdjson::ondemand::document& document)
+        {
+            std::string_view token;
+            return (simdjson::SUCCESS == document.raw_json_token().get(token)) ? token : std::string_view{};
+        }
+
+        /**
+         * @brief Walk the objects and arrays of a value so that unbalanced brackets, missing separators and values
+         *        missing altogether are reported up front.
+         * @param checkScalars Check the tokens of numbers and atoms as well; otherwise scalars are only classified by
+         *        their first character, and a malformed one is reported by the getter reading it.
+         */
+        template<typename TValue>
+        simdjson::error_code CheckStructure(TValue& value, bool checkScalars)
+        {
+            simdjson::ondemand::json_type type{};
+            simdjson::error_code error = value.type().get(type);
+            if (simdjson::SUCCESS != error)
+            {
+                return error;
+            }
+
+            if (simdjson::ondemand::json_type::object == type)
+            {
+                simdjson::ondemand::object object;
+                if (simdjson::SUCCESS != (error = value.get_object().get(object)))
+                {
+                    return error;
+                }
+
+                for (auto result : object)
+                {
+                    simdjson::ondemand::field field;
+                    if (simdjson::SUCCESS != (error = std::move(result).get(field)) ||
+                        simdjson::SUCCESS != (error = CheckStructure(field.value(), checkScalars)))
+                    {
+                        return error;
+                    }
+                }
+            }
+            else if (simdjson::ondemand::json_type::array == type)
+            {
+                simdjson::ondemand::array array;
+                if (simdjson::SUCCESS != (error = value.get_array().get(array)))
+                {
+                    return error;
+                }
+
+                for (auto result : array)
+                {
+                    simdjson::ondemand::value element;
+                    if (simdjson::SUCCESS != (error = std::move(result).get(element)) ||
+                        simdjson::SUCCESS != (error = CheckStructure(element, checkScalars)))
+                    {
+                        return error;
+                    }
+                }
+            }
+            else if (checkScalars)
+            {
+                return CheckScalar(RawToken(value));
+            }
+
+            return simdjson::SUCCESS;
+        }
+
+        /**
+         * @brief `CheckStructure()` of a whole document, whose root may be a scalar.
+         */
+        simdjson::error_code CheckDocument(simdjson::ondemand::document& document, bool checkScalars)
+        {
+            bool scalar = false;
+            simdjson::error_code error = document.is_scalar().get(scalar);
+            if (simdjson::SUCCESS != error || !scalar)
+            {
+                return (simdjson::SUCCESS != error) ? error : CheckStructure(document, checkScalars);
+            }
+
+            // a scalar root is skipped over, so that whatever follows it is found as trailing content
+            std::string_view rawValue;
+            error = document.raw_json().get(rawValue);
+            if (simdjson::SUCCESS == error && checkScalars)
+            {
+                error = CheckScalar(rawValue);
+            }
+
+            return error;
+        }
+
+        /**
+         * @brief Check that every backslash of the text starts a valid escape sequence.
+         * @note Stage 1 already delimits the strings, and backslashes are rare, so this is a `memchr()` pass that
+         *       decodes nothing.
+         */
+        simdjson::error_code CheckEscapes(std::string_view text)
+        {
+            constexpr std::string_view escapes{"\"\\/bfnrtu"};
+            constexpr std::string_view hexDigits{"0123456789abcdefABCDEF"};
+
+            for (std::size_t position = text.find('\\'); std::string_view::npos != position;
+                 position = text.find('\\', position))
+            {
+                if (position + 1 == text.size() || std::string_view::npos == escapes.find(text[position + 1]))
+                {
+                    return simdjson::STRING_ERROR;
+                }
+
+                std::size_t length = 2;
+                if ('u' == text[position + 1])
+                {
+                    length = 6;
+                    const std::string_view digits = text.substr(position + 2, 4);
+                    if (4 != digits.size() || std::string_view::npos != digits.find_first_not_of(hexDigits))
+                    {
+                        return simdjson::STRING_ERROR;
+                    }
+                }
+                position += length;
+            }
+
+            return simdjson::SUCCESS;
+        }
+
+        void AppendElement(std::string& out, int64_t value)
+        {
+            Details::AppendInt(out, value);
+        }
+
+        void AppendElement(std::string& out, uint64_t value)
+        {
+            Details::AppendUnsigned(out, value);
+        }
+
+        void AppendElement(std::string& out, double value)
+        {
+            Details::AppendDouble(out, value);
+        }
+
+        void AppendElement(std::string& out, std::string_view value)
+        {
+            Details::AppendString(out, value);
+        }
+
+        /**
+         * @brief Serialize `values` as a JSON array.
+         */
+        template<typename TValue>
+        std::string ToArray(const TValue* values, std::size_t count)
+        {
+            std::string array{"["};
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (0 != i)
+                {
+                    array.push_back(',');
+                }
+                AppendElement(array, values[i]);
+            }
+            array.push_back(']');
+
+            return array;
+        }
+
+        /**
+         * @brief Whether the On-Demand iterator is still usable after `error`.
+         */
+        bool IsRecoverable(simdjson::error_code error)
+        {
+            return simdjson::SUCCESS == error || simdjson::NO_SUCH_FIELD == error ||
+                   simdjson::INCORRECT_TYPE == error;
+        }
+
+        /**
+         * @brief The `JsonErrorCode` reported by the non-throwing lookups for a conversion error.
+         */
+        JsonErrorCode ToErrorCode(simdjson::error_code error)
+        {
+            if (simdjson::SUCCESS == error)
+            {
+                return JsonErrorCode::None;
+            }
+
+            return (simdjson::NO_SUCH_FIELD == error) ? JsonErrorCode::NoSuchKey : JsonErrorCode::IncorrectType;
+        }
+
+        /**
+         * @brief Throw `XJsonError` with `errorMessage` if `error` is set.
+         * @param rewindable Cleared unless the document iterating the text survives the error, so that the next
+         *        lookup indexes the text again.
+         */
+        void Check(simdjson::error_code error, const char* errorMessage, bool& rewindable)
+        {
+            if (simdjson::SUCCESS != error)
+            {
+                rewindable = rewindable && IsRecoverable(error);
+                throw XJsonError{errorMessage};
+            }
+        }
+
+        /**
+         * @brief Counts a nested call for its lifetime.
+         */
+        class DepthGuard
+        {
+        public:
+            explicit DepthGuard(std::size_t& depth) : _depth{depth}
+            {
+                ++_depth;
+            }
+
+            ~DepthGuard()
+            {
+                --_depth;
+            }
+
+            DepthGuard(const DepthGuard&) = delete;
+
+            DepthGuard& operator=(const DepthGuard&) = delete;
+
+        private:
+            std::size_t& _depth;
+        };
+
+    }  // namespace
+
+    /**
+     * @struct SimdJsonWrapper::Parsers
+     * @brief The simdjson state of a wrapper, out of its header.
+     */
+    struct SimdJsonWrapper::Parsers
+    {
+        /**
+         * @brief An object or array iterated by its own parser, kept for the next reads through the same handle.
+         */
+        struct NodeSlot
+        {
+            JsonNode node;
+
+            /**
+             * @brief Value of `nodeClock` when the slot was last read, to evict the least recently used one.
+             */
+            std::size_t lastUse{0};
+
+            simdjson::ondemand::parser parser;
+
+            simdjson::ondemand::document document;
+        };
+
+        /**
+         * @brief Number of objects and arrays kept iterated in `nodeSlots`, enough for a chain of nested views.
+         * @note Each parser keeps buffers for the largest value it has iterated.
+         */
+        static constexpr std::size_t NodeSlots = 8;
+
+        /**
+         * @brief Reusable On-Demand parser; its internal buffers grow to the largest document seen.
+         */
+        simdjson::ondemand::parser parser;
+
+        /**
+         * @brief Iterator over the document text. Rewound before each lookup.
+         */
+        simdjson::ondemand::document document;
+
+        /**
+         * @brief Parser for nested scalars read through `JsonNode` handles, so that `document` stays valid.
+         */
+        simdjson::ondemand::parser nodeParser;
+
+        /**
+         * @brief Iterator over the nested scalar last read through `nodeParser`.
+         */
+        simdjson::ondemand::document nodeDocument;
+
+        /**
+         * @brief The nested objects and arrays read last, each with its own parser. Kept until the text changes.
+         */
+        std::array<NodeSlot, NodeSlots> nodeSlots;
+
+        /**
+         * @brief Counts the reads through `nodeSlots`.
+         */
+        std::size_t nodeClock{0};
+
+        /**
+         * @brief Parsers of `NodeForEachMember()`, one per level of nested visits, so that a visitor can read members
+         *        and visit inner objects while the enclosing object is still being walked. Reused across visits.
+         */
+        std::deque<simdjson::ondemand::parser> memberParsers;
+
+        /**
+         * @brief Parser splitting the batches of `OpenStream()`, kept so that its buffers are reused across streams.
+         */
+        simdjson::ondemand::parser streamParser;
+
+        /**
+         * @brief The document lookups start from: `document`, or the current document of a stream, read through the
+         *        index `streamParser` built for the whole batch.
+         */
+        simdjson::ondemand::document* root{&document};
+    };
+
+    /**
+     * @class SimdJsonWrapper::StreamCursor
+     * @brief Walks the documents found by `iterate_many()` and shows each one in the wrapper where it lies in the
+     *        batch, read through the index built for the whole batch.
+     * @note The wrapper copies the current document once the cursor is gone, as the batch may go with it.
+     */
+    class SimdJsonWrapper::StreamCursor : public IJsonStreamCursor
+    {
+    public:
+        StreamCursor(SimdJsonWrapper& document, std::string_view batch, const JsonStreamOptions& options)
+            : _document{&document},
+              _batch{},
+              _text{batch.data()},
+              _capacity{batch.size() + options.padding},
+              _stream{},
+              _current{}
+        {
+            // iterate_many() reads up to SIMDJSON_PADDING bytes past the end of the batch
+            if (options.padding < simdjson::SIMDJSON_PADDING)
+            {
+                _batch.reserve(batch.size() + simdjson::SIMDJSON_PADDING);
+                _batch.assign(batch.data(), batch.size());
+                _batch.append(simdjson::SIMDJSON_PADDING, ' ');
+                _text = _batch.data();
+                _capacity = _batch.size();
+            }
+
+            simdjson::ondemand::parser& parser = document._parsers->streamParser;
+#ifdef SIMDJSON_THREADS_ENABLED
+            parser.threaded = options.threaded;
+#endif
+
+            if (simdjson::SUCCESS != parser.iterate_many(_text, batch.size(), options.batchSize).get(_stream))
+            {
+                throw XJsonError{"Failed to open the JSON stream."};
+            }
+        }
+
+        ~StreamCursor() override
+        {
+            SimdJsonWrapper& document = *_document;
+            if (document._parsers->root != &document._parsers->document)
+            {
+                // moves the text to the buffer, and the next lookup indexes it there
+                document.EditText(0, 0, std::string_view{});
+                document._parsers->root = &document._parsers->document;
+            }
+        }
+
+        bool Next() override
+        {
+            if (_finished)
+            {
+                return false;
+            }
+
+            if (_started)
+            {
+                ++_current;
+            }
+            else
+            {
+                _current = _stream.begin();
+                _started = true;
+            }
+
+            if (!(_current != _stream.end()))
+            {
+                _finished = true;
+                if (0 != _stream.truncated_bytes())
+                {
+                    throw XJsonError{"Truncated JSON document at the end of the stream."};
+                }
+                return false;
+            }
+
+            _offset = _current.current_index();
+            simdjson::ondemand::document_reference current;
+            if (simdjson::SUCCESS != (*_current).get(current))
+            {
+                // the document boundaries are lost, so nothing after this point can be trusted
+                _finished = true;
+                throw XJsonError{"Failed to parse JSON string."};
+            }
+
+            Show(_current.source(), current);
+            return true;
+        }
+
+        std::size_t Offset() const override
+        {
+            return _offset;
+        }
+
+    private:
+        /**
+         * @brief Make `source`, iterated by `current`, the document of the wrapper after checking it as `Parse()`
+         *        does, without copying or indexing it again.
+         * @throw XJsonError If the document is malformed; the wrapper is then null.
+         */
+        void Show(std::string_view source, simdjson::ondemand::document& current)
+        {
+            SimdJsonWrapper& document = *_document;
+            document._keyIndex.clear();
+            document._unescapedKeys.clear();
+            document._keysIndexed = false;
+            document.ForgetNodes();
+            document._mappedFile = Details::MappedFile{};
+            document._text = source.data();
+            document._length = source.size();
+            document._capacity = _capacity - static_cast<std::size_t>(source.data() - _text);
+            document._parsers->root = &current;
+
+            // the stream ends each document at its last structural character, so there is no trailing content
+            simdjson::error_code error = CheckEscapes(source);
+            if (simdjson::SUCCESS == error)
+            {
+                error = CheckDocument(current, true);
+            }
+            document._rewindable = simdjson::SUCCESS == error;
+            if (!document._rewindable)
+            {
+                document.Load("null");
+                throw XJsonError{"Failed to parse JSON string."};
+            }
+            current.rewind();
+        }
+
+        SimdJsonWrapper* _document;
+
+        /**
+         * @brief The batch with padding, if the caller's doesn't have enough; empty otherwise.
+         */
+        std::string _batch;
+
+        /**
+         * @brief The batch iterated: the caller's, or `_batch`.
+         */
+        const char* _text;
+
+        /**
+         * @brief Bytes readable from `_text`, padding included.
+         */
+        std::size_t _capacity;
+
+        simdjson::ondemand::document_stream _stream;
+        simdjson::ondemand::document_stream::iterator _current;
+        std::size_t _offset{0};
+        bool _started{false};
+        bool _finished{false};
+    };
+
+    /**
+     * @class SimdJsonWrapper::FeedCursor
+     * @brief Appends the top level members and array elements cut by a `Details::JsonMemberSplitter` to the text of
+     *        the document, which it builds compact from `{}` or `[]`, each checked in place as it is added.
+     * @note Repeated keys are appended again, as in a parsed text, and the key index is rebuilt when next read, so
+     *       that adding a member costs in proportion to the member rather than to the document.
+     */
+    class SimdJsonWrapper::FeedCursor : public IJsonFeedCursor
+    {
+    public:
+        explicit FeedCursor(SimdJsonWrapper& document) : _document{&document}, _splitter{true}
+        {
+        }
+
+        void Feed(std::string_view chunk) override
+        {
+            const bool started = _splitter.IsObject() || _splitter.IsArray();
+            const std::vector<Details::JsonMemberSplitter::Member>& members = _splitter.Feed(chunk);
+            if (!started && _splitter.IsObject())
+            {
+                _document->Load("{}");
+            }
+            else if (!started && _splitter.IsArray())
+            {
+                _document->Load("[]");
+            }
+
+            for (const Details::JsonMemberSplitter::Member& member : members)
+            {
+                _prefix.clear();
+                if (_splitter.IsArray())
+                {
+                    Append(member.value, "]");
+                }
+                else if (Details::JsonMemberSplitter::Kind::Element == member.kind)
+                {
+                    // the array being split is the last member
+                    Append(member.value, "]}");
+                }
+                else
+                {
+                    Details::AppendString(_prefix, member.key);
+                    _prefix.push_back(':');
+                    Append(member.value, "}");
+                }
+            }
+        }
+
+        void Finish() override
+        {
+            const std::string_view text = _splitter.Finish();
+            if (!_splitter.IsObject() && !_splitter.IsArray())
+            {
+                _document->Load(text);
+            }
+        }
+
+    private:
+        /**
+         * @brief Insert `_prefix` and `rawValue` before the `closing` brackets that end the text, with a comma unless
+         *        they open it.
+         * @throw XJsonError If `rawValue` is malformed, with the text left as it was, or if the document was changed
+         *        since the feed started.
+         */
+        void Append(std::string_view rawValue, std::string_view closing)
+        {
+            SimdJsonWrapper& document = *_document;
+            std::pmr::string& buffer = document._buffer;
+            if (buffer.data() != document._text || document._length < closing.size() + 1 ||
+                document.Text().substr(document._length - closing.size()) != closing)
+            {
+                throw XJsonError{"The JSON document was changed while it was fed."};
+            }
+
+            const std::size_t length = document._length - closing.size();
+            const char last = buffer[length - 1];
+
+            buffer.resize(length);
+            if ('{' != last && '[' != last)
+            {
+                buffer.push_back(',');
+            }
+            buffer.append(_prefix);
+            const std::size_t valuePosition = buffer.size();
+            buffer.append(rawValue);
+            Close(buffer.size(), closing);
+
+            const bool verified = document.Verify(valuePosition, rawValue.size(), true);
+            // the iterator is left on the value, not the document
+            document._rewindable = false;
+            if (!verified)
+            {
+                buffer.resize(length);
+                Close(length, closing);
+                throw XJsonError{"Failed to parse JSON string."};
+            }
+        }
+
+        /**
+         * @brief Put `closing` and the padding after the first `length` bytes of the buffer, and point the document
+         *        at the text.
+         */
+        void Close(std::size_t length, std::string_view closing)
+        {
+            SimdJsonWrapper& document = *_document;
+            document._buffer.resize(length);
+            document._buffer.append(closing);
+            document._buffer.append(simdjson::SIMDJSON_PADDING, ' ');
+
+            document._text = document._buffer.data();
+            document._length = length + closing.size();
+            document._capacity = document._buffer.size();
+            document._keyIndex.clear();
+            document._unescapedKeys.clear();
+            document._keysIndexed = false;
+            document._rewindable = false;
+            document.ForgetNodes();
+        }
+
+        SimdJsonWrapper* _document;
+        Details::JsonMemberSplitter _splitter;
+
+        /**
+         * @brief The quoted key and colon of the member being appended, reused across members.
+         */
+        std::string _prefix;
+    };
+
+    SimdJsonWrapper::SimdJsonWrapper() : SimdJsonWrapper{nullptr}
+    {
+    }
+
+    SimdJsonWrapper::SimdJsonWrapper(std::pmr::memory_resource* resource)
+        : _resource{resource},
+          _buffer{(nullptr != resource) ? resource : std::pmr::get_default_resource()},
+          _mappedFile{},
+          _parsers{std::make_unique<Parsers>()},
+          _unescapedStrings{},
+          _unescapedKeys{},
+          _keyIndex{},
+          _elements{}
+    {
+        Load("null");
+    }
+
+    SimdJsonWrapper::~SimdJsonWrapper() = default;
+
+    void SimdJsonWrapper::SetInt(std::string_view key, int64_t value)
+    {
+        std::string rawValue;
+        Details::AppendInt(rawValue, value);
+        SetMember(key, rawValue);
+    }
+
+    void SimdJsonWrapper::SetUnsigned(std::string_view key, uint64_t value)
+    {
+        std::string rawValue;
+        Details::AppendUnsigned(rawValue, value);
+        SetMember(key, rawValue);
+    }
+
+    void SimdJsonWrapper::SetDouble(std::string_view key, double value)
+    {
+        std::string rawValue;
+        Details::AppendDouble(rawValue, value);
+        SetMember(key, rawValue);
+    }
+
+    void SimdJsonWrapper::SetBool(std::string_view key, bool value)
+    {
+        SetMember(key, value ? "true" : "false");
+    }
+
+    void SimdJsonWrapper::SetString(std::string_view key, std::string_view value)
+    {
+        std::string rawValue;
+        Details::AppendString(rawValue, value);
+        SetMember(key, rawValue);
+    }
+
+    void SimdJsonWrapper::SetObject(std::string_view key, std::unique_ptr<IJsonWrapper> jsonObject)
+    {
+        if (nullptr == jsonObject)
+        {
+            throw XJsonError{"Invalid JSON object to set."};
+        }
+
+        if (nullptr == dynamic_cast<SimdJsonWrapper*>(jsonObject.get()))
+        {
+            // the document is text, so a child of another backend is written out from its events, not canonicalized
+            std::string rawValue;
+            JsonWriter writer{rawValue};
+            EmitDocument(*jsonObject, writer);
+            writer.Finish();
+
+            SetMember(key, rawValue);
+            return;
+        }
+
+        SetObject(key, std::unique_ptr<SimdJsonWrapper>{static_cast<SimdJsonWrapper*>(jsonObject.release())});
+    }
+
+    void SimdJsonWrapper::SetObject(std::string_view key, std::unique_ptr<SimdJsonWrapper> jsonObject)
+    {
+        if (nullptr == jsonObject)
+        {
+            throw XJsonError{"Invalid JSON object to set."};
+        }
+
+        SetMember(key, jsonObject->Text());
+    }
+
+    void SimdJsonWrapper::SetNull(std::string_view key)
+    {
+        SetMember(key, "null");
+    }
+
+    void SimdJsonWrapper::SetIntArray(std::string_view key, const int64_t* values, std::size_t count)
+    {
+        SetMember(key, ToArray(values, count));
+    }
+
+    void SimdJsonWrapper::SetUnsignedArray(std::string_view key, const uint64_t* values, std::size_t count)
+    {
+        SetMember(key, ToArray(values, count));
+    }
+
+    void SimdJsonWrapper::SetDoubleArray(std::string_view key, const double* values, std::size_t count)
+    {
+        SetMember(key, ToArray(values, count));
+    }
+
+    void SimdJsonWrapper::SetStringArray(std::string_view key, const std::string_view* values, std::size_t count)
+    {
+        SetMember(key, ToArray(values, count));
+    }
+
+    int64_t SimdJsonWrapper::GetInt(std::string_view key) const
+    {
+        return NodeToInt(KeyNode(key));
+    }
+
+    uint64_t SimdJsonWrapper::GetUnsigned(std::string_view key) const
+    {
+        return NodeToUnsigned(KeyNode(key));
+    }
+
+    double SimdJsonWrapper::GetDouble(std::string_view key) const
+    {
+        return NodeToDouble(KeyNode(key));
+    }
+
+    bool SimdJsonWrapper::GetBool(std::string_view key) const
+    {
+        return NodeToBool(KeyNode(key));
+    }
+
+    std::string SimdJsonWrapper::GetString(std::string_view key) const
+    {
+        return NodeCopyString(KeyNode(key));
+    }
+
+    std::string_view SimdJsonWrapper::GetStringView(std::string_view key) const
+    {
+        return NodeToStringView(KeyNode(key));
+    }
+
+    std::unique_ptr<IJsonWrapper> SimdJsonWrapper::GetObject(std::string_view key) const
+    {
+        return NodeToObject(KeyNode(key));
+    }
+
+    bool SimdJsonWrapper::IsNull(std::string_view key) const
+    {
+        return NodeIsNull(KeyNode(key));
+    }
+
+    bool SimdJsonWrapper::HasKey(std::string_view key) const
+    {
+        return nullptr != KeyNode(key).data;
+    }
+
+    int64_t SimdJsonWrapper::GetInt(const JsonKey& key) const
+    {
+        return NodeToInt(KeyNode(key.Name(), key.Hash()));
+    }
+
+    uint64_t SimdJsonWrapper::GetUnsigned(const JsonKey& key) const
+    {
+        return NodeToUnsigned(KeyNode(key.Name(), key.Hash()));
+    }
+
+    double SimdJsonWrapper::GetDouble(const JsonKey& key) const
+    {
+        return NodeToDouble(KeyNode(key.Name(), key.Hash()));
+    }
+
+    bool SimdJsonWrapper::GetBool(const JsonKey& key) const
+    {
+        return NodeToBool(KeyNode(key.Name(), key.Hash()));
+    }
+
+    std::string SimdJsonWrapper::GetString(const JsonKey& key) const
+    {
+        return NodeCopyString(KeyNode(key.Name(), key.Hash()));
+    }
+
+    std::string_view SimdJsonWrapper::GetStringView(const JsonKey& key) const
+    {
+        return NodeToStringView(KeyNode(key.Name(), key.Hash()));
+    }
+
+    bool SimdJsonWrapper::IsNull(const JsonKey& key) const
+    {
+        return NodeIsNull(KeyNode(key.Name(), key.Hash()));
+    }
+
+    bool SimdJsonWrapper::HasKey(const JsonKey& key) const
+    {
+        return nullptr != KeyNode(key.Name(), key.Hash()).data;
+    }
+
+    std::unique_ptr<IJsonWrapper> SimdJsonWrapper::GetEmptyObject() const
+    {
+        std::unique_ptr<SimdJsonWrapper> emptyObject = MakeNested<SimdJsonWrapper>(_resource, _resource);
+        emptyObject->Load("{}");
+
+        return emptyObject;
+    }
+
+    bool SimdJsonWrapper::AllowsConcurrentReads() const
+    {
+        return false;
+    }
+
+    void SimdJsonWrapper::Parse(std::string_view inputJson)
+    {
+        Load(inputJson);
+    }
+
+    void SimdJsonWrapper::ParseLazy(std::string_view inputJson)
+    {
+        Load(inputJson, false);
+    }
+
+    void SimdJsonWrapper::ParseFile(const std::string& filePath)
+    {
+        Details::MappedFile mappedFile{filePath, simdjson::SIMDJSON_PADDING};
+
+        _keyIndex.clear();
+        _unescapedKeys.clear();
+        _keysIndexed = false;
+        ForgetNodes();
+        _mappedFile = std::move(mappedFile);
+        _text = _mappedFile.Data();
+        _length = _mappedFile.Size();
+        _capacity = _mappedFile.Capacity();
+
+        if (!Verify(0, _length, true))
+        {
+            Load("null");
+            throw XJsonError{"Failed to parse JSON string."};
+        }
+    }
+
+    std::string SimdJsonWrapper::ToString() const
+    {
+        constexpr const char* errorMessage = "Failed to convert JSON object to String. Verify if it's UTF-8 encoded.";
+
+        Rewind();
+
+        std::string json;
+        json.reserve(_length);
+        Check(WriteCanonical(json, *_parsers->root), errorMessage, _rewindable);
+
+        return json;
+    }
+
+    JsonNode SimdJsonWrapper::RootNode() const
+    {
+        return JsonNode{_text, _length};
+    }
+
+    // defined ahead of its callers, which need its deduced return type
+    auto& SimdJsonWrapper::NodeDocument(JsonNode node, const char* errorMessage) const
+    {
+        if (nullptr == node.data)
+        {
+            throw XJsonError{errorMessage};
+        }
+
+        if (IsRoot(node))
+        {
+            Rewind();
+            return *_parsers->root;
+        }
+
+        // nodes are slices of the document text, so the rest of the text serves as their padding
+        const char* text = static_cast<const char*>(node.data);
+        const std::size_t capacity = _capacity - static_cast<std::size_t>(text - _text);
+        const simdjson::padded_string_view view{text, node.size, capacity};
+
+        // scalars have a parser of their own, so that reading the members of an object doesn't evict it
+        if (!NodeIsObject(node) && !NodeIsArray(node))
+        {
+            if (simdjson::SUCCESS != _parsers->nodeParser.iterate(view).get(_parsers->nodeDocument))
+            {
+                throw XJsonError{errorMessage};
+            }
+            return _parsers->nodeDocument;
+        }
+
+        // the least recently read object or array makes room for a new one
+        std::size_t& nodeClock = _parsers->nodeClock;
+        Parsers::NodeSlot* slot = &_parsers->nodeSlots.front();
+        for (Parsers::NodeSlot& candidate : _parsers->nodeSlots)
+        {
+            if (candidate.node.data == node.data && candidate.node.size == node.size)
+            {
+                candidate.lastUse = ++nodeClock;
+                candidate.document.rewind();
+                return candidate.document;
+            }
+
+            if (candidate.lastUse < slot->lastUse)
+            {
+                slot = &candidate;
+            }
+        }
+
+        slot->node = JsonNode{};
+        if (simdjson::SUCCESS != slot->parser.iterate(view).get(slot->document))
+        {
+            throw XJsonError{errorMessage};
+        }
+        slot->node = node;
+        slot->lastUse = ++nodeClock;
+
+        return slot->document;
+    }
+
+    JsonNode SimdJsonWrapper::MemberNode(JsonNode object, std::string_view key) const
+    {
+        constexpr const char* errorMessage = "Failed to read JSON value.";
+
+        if (nullptr == object.data)
+        {
+            return JsonNode{};
+        }
+
+        if (IsRoot(object))
+        {
+            return KeyNode(key);
+        }
+
+        simdjson::ondemand::object members;
+        const simdjson::error_code error = NodeDocument(object, errorMessage).get_object().get(members);
+        if (simdjson::INCORRECT_TYPE == error)
+        {
+            return JsonNode{};
+        }
+        Check(error, errorMessage, _rewindable);
+
+        // every member is compared, so that a repeated key resolves to its last value as in the serialized text
+        JsonNode node;
+        for (auto result : members)
+        {
+            simdjson::ondemand::field member;
+            Check(std::move(result).get(member), errorMessage, _rewindable);
+
+            // keys are compared unescaped; the raw key is only decoded when it has escapes
+            std::string_view memberKey = member.escaped_key();
+            if (std::string_view::npos != memberKey.find('\\'))
+            {
+                Check(member.unescaped_key().get(memberKey), errorMessage, _rewindable);
+            }
+
+            if (memberKey == key)
+            {
+                std::string_view rawValue;
+                Check(member.value().raw_json().get(rawValue), errorMessage, _rewindable);
+                node = JsonNode{rawValue.data(), rawValue.size()};
+            }
+        }
+
+        return node;
+    }
+
+    int64_t SimdJsonWrapper::NodeToInt(JsonNode node) const
+    {
+        constexpr const char* errorMessage = "Failed to get Integer value.";
+
+        int64_t value = 0;
+        Check(NodeDocument(node, errorMessage).get_int64().get(value), errorMessage, _rewindable);
+        return value;
+    }
+
+    uint64_t SimdJsonWrapper::NodeToUnsigned(JsonNode node) const
+    {
+        constexpr const char* errorMessage = "Failed to get Unsigned Integer value.";
+
+        uint64_t value = 0;
+        Check(NodeDocument(node, errorMessage).get_uint64().get(value), errorMessage, _rewindable);
+        return value;
+    }
+
+    double SimdJsonWrapper::NodeToDouble(JsonNode node) const
+    {
+        constexpr const char* errorMessage = "Failed to get Double value.";
+
+        double value = 0;
+        Check(NodeDocument(node, errorMessage).get_double().get(value), errorMessage, _rewindable);
+        return value;
+    }
+
+    bool SimdJsonWrapper::NodeToBool(JsonNode node) const
+    {
+        constexpr const char* errorMessage = "Failed to get Boolean value.";
+
+        bool value = false;
+        Check(NodeDocument(node, errorMessage).get_bool().get(value), errorMessage, _rewindable);
+        return value;
+    }
+
+    std::string_view SimdJsonWrapper::NodeToStringView(JsonNode node) const
+    {
+        constexpr const char* errorMessage = "Failed to get String value.";
+
+        std::string_view value;
+        if (NodeRawString(node, value))
+        {
+            return value;
+        }
+
+        // the parser's scratch buffer is reused by the next read, so each string with escapes is kept once
+        const auto unescaped = _unescapedStrings.find(node.data);
+        if (_unescapedStrings.end() != unescaped)
+        {
+            return unescaped->second;
+        }
+
+        Check(NodeDocument(node, errorMessage).get_string().get(value), errorMessage, _rewindable);
+        return _unescapedStrings.emplace(node.data, value).first->second;
+    }
+
+    JsonErrorCode SimdJsonWrapper::NodeTryToInt(JsonNode node, int64_t& value) const
+    {
+        return NodeTryTo(node, value);
+    }
+
+    JsonErrorCode SimdJsonWrapper::NodeTryToUnsigned(JsonNode node, uint64_t& value) const
+    {
+        return NodeTryTo(node, value);
+    }
+
+    JsonErrorCode SimdJsonWrapper::NodeTryToDouble(JsonNode node, double& value) const
+    {
+        return NodeTryTo(node, value);
+    }
+
+    JsonErrorCode SimdJsonWrapper::NodeTryToBool(JsonNode node, bool& value) const
+    {
+        return NodeTryTo(node, value);
+    }
+
+    JsonErrorCode SimdJsonWrapper::NodeTryToStringView(JsonNode node, std::string_view& value) const
+    {
+        if (NodeRawString(node, value))
+        {
+            return JsonErrorCode::None;
+        }
+
+        const auto unescaped = _unescapedStrings.find(node.data);
+        if (_unescapedStrings.end() != unescaped)
+        {
+            value = unescaped->second;
+            return JsonErrorCode::None;
+        }
+
+        std::string_view scratch;
+        const JsonErrorCode error = NodeTryTo(node, scratch);
+        if (JsonErrorCode::None == error)
+        {
+            value = _unescapedStrings.emplace(node.data, scratch).first->second;
+        }
+
+        return error;
+    }
+
+    bool SimdJsonWrapper::NodeIsNull(JsonNode node) const
+    {
+        if (nullptr == node.data)
+        {
+            throw XJsonError{"Failed to check nullability of the value."};
+        }
+
+        // scalars are not checked by `ParseLazy()`, so the whole atom is compared
+        return "null" == NodeText(node);
+    }
+
+    bool SimdJsonWrapper::NodeIsObject(JsonNode node) const
+    {
+        const std::string_view text = NodeText(node);
+        return !text.empty() && '{' == text.front();
+    }
+
+    bool SimdJsonWrapper::NodeIsArray(JsonNode node) const
+    {
+        const std::string_view text = NodeText(node);
+        return !text.empty() && '[' == text.front();
+    }
+
+    std::size_t SimdJsonWrapper::NodeArraySize(JsonNode node) const
+    {
+        constexpr const char* errorMessage = "Failed to get Array.";
+
+        if (nullptr != node.data && _elementsOf.data == node.data && _elementsOf.size == node.size)
+        {
+            return _elements.size();
+        }
+
+        simdjson::ondemand::array array;
+        std::size_t size = 0;
+        simdjson::error_code error = NodeDocument(node, errorMessage).get_array().get(array);
+        if (simdjson::SUCCESS == error)
+        {
+            // walks the structural index only, numbers and strings are not decoded
+            error = array.count_elements().get(size);
+        }
+        Check(error, errorMessage, _rewindable);
+
+        return size;
+    }
+
+    JsonNode SimdJsonWrapper::ElementNode(JsonNode array, std::size_t index) const
+    {
+        if (!NodeIsArray(array))
+        {
+            return JsonNode{};
+        }
+
+        if (_elementsOf.data != array.data || _elementsOf.size != array.size)
+        {
+            _elements = ElementNodes(array);
+            _elementsOf = array;
+        }
+
+        return (index < _elements.size()) ? _elements[index] : JsonNode{};
+    }
+
+    std::vector<JsonNode> SimdJsonWrapper::ElementNodes(JsonNode array) const
+    {
+        constexpr const char* errorMessage = "Failed to read JSON value.";
+
+        simdjson::ondemand::array elements;
+        Check(NodeDocument(array, errorMessage).get_array().get(elements), errorMessage, _rewindable);
+
+        std::vector<JsonNode> nodes;
+        for (auto result : elements)
+        {
+            simdjson::ondemand::value element;
+            std::string_view rawValue;
+            Check(std::move(result).get(element), errorMessage, _rewindable);
+            Check(element.raw_json().get(rawValue), errorMessage, _rewindable);
+            nodes.push_back(JsonNode{rawValue.data(), rawValue.size()});
+        }
+
+        return nodes;
+    }
+
+    void SimdJsonWrapper::NodeForEachMember(JsonNode object, IJsonMemberVisitor& visitor) const
+    {
+        constexpr const char* errorMessage = "Failed to get Inner Object.";
+
+        if (nullptr == object.data)
+        {
+            throw XJsonError{errorMessage};
+        }
+
+        // the visitor may visit nested objects before returning, so each level walks its object with its own parser
+        std::deque<simdjson::ondemand::parser>& memberParsers = _parsers->memberParsers;
+        if (_memberDepth == memberParsers.size())
+        {
+            memberParsers.emplace_back();
+        }
+        simdjson::ondemand::parser& parser = memberParsers[_memberDepth];
+        const DepthGuard depth{_memberDepth};
+
+        const char* text = static_cast<const char*>(object.data);
+        const std::size_t capacity = _capacity - static_cast<std::size_t>(text - _text);
+        const simdjson::padded_string_view view{text, object.size, capacity};
+        simdjson::ondemand::document document;
+        simdjson::ondemand::object members;
+        if (simdjson::SUCCESS != parser.iterate(view).get(document) ||
+            simdjson::SUCCESS != document.get_object().get(members))
+        {
+            throw XJsonError{errorMessage};
+        }
+
+        for (auto result : members)
+        {
+            simdjson::ondemand::field member;
+            std::string_view key;
+            std::string_view rawValue;
+            simdjson::error_code error = std::move(result).get(member);
+            if (simdjson::SUCCESS == error)
+            {
+                error = member.unescaped_key().get(key);
+            }
+            if (simdjson::SUCCESS == error)
+            {
+                error = member.value().raw_json().get(rawValue);
+            }
+            if (simdjson::SUCCESS != error)
+            {
+                throw XJsonError{errorMessage};
+            }
+
+            visitor.Visit(key, JsonView{*this, JsonNode{rawValue.data(), rawValue.size()}});
+        }
+    }
+
+    std::size_t SimdJsonWrapper::NodeToIntArray(JsonNode node, int64_t* values, std::size_t capacity) const
+    {
+        return NodeToNumbers(node, values, capacity, "Failed to get Integer Array.");
+    }
+
+    std::size_t SimdJsonWrapper::NodeToUnsignedArray(JsonNode node, uint64_t* values, std::size_t capacity) const
+    {
+        return NodeToNumbers(node, values, capacity, "Failed to get Unsigned Integer Array.");
+    }
+
+    std::size_t SimdJsonWrapper::NodeToDoubleArray(JsonNode node, double* values, std::size_t capacity) const
+    {
+        return NodeToNumbers(node, values, capacity, "Failed to get Double Array.");
+    }
+
+    std::unique_ptr<IJsonWrapper> SimdJsonWrapper::NodeToObject(JsonNode node) const
+    {
+        if (nullptr == node.data)
+        {
+            throw XJsonError("Failed to get Inner Object.");
+        }
+
+        std::unique_ptr<SimdJsonWrapper> simdJsonWrapper = MakeNested<SimdJsonWrapper>(_resource, _resource);
+        simdJsonWrapper->Load(NodeText(node));
+
+        return simdJsonWrapper;
+    }
+
+    std::string SimdJsonWrapper::NodeToString(JsonNode node) const
+    {
+        constexpr const char* errorMessage = "Failed to convert JSON object to String. Verify if it's UTF-8 encoded.";
+
+        std::string json;
+        json.reserve(node.size);
+        Check(WriteCanonical(json, NodeDocument(node, errorMessage)), errorMessage, _rewindable);
+
+        return json;
+    }
+
+    void SimdJsonWrapper::NodeSerialize(JsonNode node, Details::JsonOutput& output) const
+    {
+        constexpr const char* errorMessage = "Failed to convert JSON object to String. Verify if it's UTF-8 encoded.";
+
+        Check(WriteCanonical(output, NodeDocument(node, errorMessage)), errorMessage, _rewindable);
+    }
+
+    void SimdJsonWrapper::NodeEmit(JsonNode node, IJsonHandler& handler) const
+    {
+        constexpr const char* errorMessage = "Failed to convert JSON object.";
+
+        Check(EmitValue(NodeDocument(node, errorMessage), handler), errorMessage, _rewindable);
+    }
+
+    void SimdJsonWrapper::NodeSerializeConcurrent(JsonNode node, Details::JsonOutput& output) const
+    {
+        constexpr const char* errorMessage = "Failed to convert JSON object to String. Verify if it's UTF-8 encoded.";
+
+        if (nullptr == node.data)
+        {
+            throw XJsonError{errorMessage};
+        }
+
+        thread_local simdjson::ondemand::parser parser;
+
+        const char* text = static_cast<const char*>(node.data);
+        const std::size_t capacity = _capacity - static_cast<std::size_t>(text - _text);
+        const simdjson::padded_string_view view{text, node.size, capacity};
+        simdjson::ondemand::document document;
+        if (simdjson::SUCCESS != parser.iterate(view).get(document) ||
+            simdjson::SUCCESS != WriteCanonical(output, document))
+        {
+            throw XJsonError{errorMessage};
+        }
+    }
+
+    std::unique_ptr<IJsonStreamCursor> SimdJsonWrapper::OpenStream(std::string_view batch,
+                                                                   const JsonStreamOptions& options)
+    {
+        return std::make_unique<StreamCursor>(*this, batch, options);
+    }
+
+    std::unique_ptr<IJsonFeedCursor> SimdJsonWrapper::OpenFeed()
+    {
+        return std::make_unique<FeedCursor>(*this);
+    }
+
+    void SimdJsonWrapper::Load(std::string_view json, bool checkScalars)
+    {
+        _buffer.assign(json.data(), json.size());
+        _buffer.append(simdjson::SIMDJSON_PADDING, ' ');
+        // `json` may be a slice of the mapping, so it is only released once copied
+        Reload(json.size(), checkScalars);
+    }
+
+    void SimdJsonWrapper::Reload(std::size_t length, bool checkScalars)
+    {
+        _keyIndex.clear();
+        _unescapedKeys.clear();
+        _keysIndexed = false;
+        ForgetNodes();
+        _mappedFile = Details::MappedFile{};
+        _text = _buffer.data();
+        _length = length;
+        _capacity = _buffer.size();
+
+        if (!Verify(0, _length, checkScalars))
+        {
+            Load("null");
+            throw XJsonError{"Failed to parse JSON string."};
+        }
+    }
+
+    bool SimdJsonWrapper::Index(std::size_t position, std::size_t length) const
+    {
+        const simdjson::padded_string_view view{_text + position, length, _capacity - position};
+        _rewindable = simdjson::SUCCESS == _parsers->parser.iterate(view).get(_parsers->document);
+        _parsers->root = &_parsers->document;
+
+        return _rewindable;
+    }
+
+    bool SimdJsonWrapper::Verify(std::size_t position, std::size_t length, bool checkScalars) const
+    {
+        simdjson::ondemand::document& document = _parsers->document;
+        simdjson::error_code error = CheckEscapes(Text().substr(position, length));
+        if (simdjson::SUCCESS == error && !Index(position, length))
+        {
+            error = simdjson::TAPE_ERROR;
+        }
+
+        if (simdjson::SUCCESS == error)
+        {
+            error = CheckDocument(document, checkScalars);
+        }
+
+        if (simdjson::SUCCESS == error && !document.at_end())
+        {
+            error = simdjson::TRAILING_CONTENT;
+        }
+
+        if (simdjson::SUCCESS == error)
+        {
+            document.rewind();
+        }
+        _rewindable = simdjson::SUCCESS == error;
+
+        return _rewindable;
+    }
+
+    void SimdJsonWrapper::Rewind() const
+    {
+        if (_rewindable)
+        {
+            _parsers->root->rewind();
+        }
+        else if (!Index(0, _length))
+        {
+            throw XJsonError{"Failed to re-index the JSON document."};
+        }
+    }
+
+    void SimdJsonWrapper::IndexKeys() const
+    {
+        constexpr const char* errorMessage = "Failed to read JSON value.";
+
+        if (_keysIndexed)
+        {
+            return;
+        }
+
+        Rewind();
+        _keyIndex.clear();
+        _unescapedKeys.clear();
+
+        simdjson::ondemand::json_type type{};
+        Check(_parsers->root->type().get(type), errorMessage, _rewindable);
+
+        if (simdjson::ondemand::json_type::object == type)
+        {
+            simdjson::ondemand::object object;
+            Check(_parsers->root->get_object().get(object), errorMessage, _rewindable);
+
+            for (auto result : object)
+            {
+                simdjson::ondemand::field field;
+                Check(std::move(result).get(field), errorMessage, _rewindable);
+
+                // the escaped key is a slice of the text; only keys with escapes need a copy that outlives the lookup
+                std::string_view key = field.escaped_key();
+                if (std::string_view::npos != key.find('\\'))
+                {
+                    Check(field.unescaped_key().get(key), errorMessage, _rewindable);
+                    key = _unescapedKeys.emplace_back(key);
+                }
+
+                std::string_view rawValue;
+                Check(field.value().raw_json().get(rawValue), errorMessage, _rewindable);
+
+                _keyIndex.push_back(
+                    KeyEntry{std::hash<std::string_view>{}(key), key, JsonNode{rawValue.data(), rawValue.size()}});
+            }
+        }
+
+        std::stable_sort(_keyIndex.begin(), _keyIndex.end(), [](const KeyEntry& left, const KeyEntry& right) {
+            return left.hash < right.hash;
+        });
+        _keysIndexed = true;
+    }
+
+    JsonNode SimdJsonWrapper::KeyNode(std::string_view key, std::size_t hash) const
+    {
+        IndexKeys();
+
+        auto entry = std::lower_bound(
+            _keyIndex.begin(), _keyIndex.end(), hash, [](const KeyEntry& candidate, std::size_t keyHash) {
+                return candidate.hash < keyHash;
+            });
+
+        // entries of equal hash are in document order, so the last match is the member that serialization keeps
+        JsonNode node;
+        for (; entry != _keyIndex.end() && entry->hash == hash; ++entry)
+        {
+            if (entry->key == key)
+            {
+                node = entry->value;
+            }
+        }
+
+        return node;
+    }
+
+    JsonNode SimdJsonWrapper::KeyNode(std::string_view key) const
+    {
+        return KeyNode(key, std::hash<std::string_view>{}(key));
+    }
+
+    bool SimdJsonWrapper::IsRoot(JsonNode node) const
+    {
+        return _text == node.data && _length == node.size;
+    }
+
+    std::string_view SimdJsonWrapper::NodeText(JsonNode node) const
+    {
+        const std::string_view text{static_cast<const char*>(node.data), node.size};
+        const std::size_t begin = text.find_first_not_of(" \t\n\r");
+        if (std::string_view::npos == begin)
+        {
+            return std::string_view{};
+        }
+
+        return text.substr(begin, text.find_last_not_of(" \t\n\r") + 1 - begin);
+    }
+
+    bool SimdJsonWrapper::NodeRawString(JsonNode node, std::string_view& value) const
+    {
+        const std::string_view text = NodeText(node);
+        if (text.empty() || '"' != text.front())
+        {
+            return false;
+        }
+
+        const std::size_t end = text.find_first_of("\"\\", 1);
+        if (std::string_view::npos == end || '"' != text[end])
+        {
+            return false;
+        }
+
+        value = text.substr(1, end - 1);
+        return true;
+    }
+
+    std::string SimdJsonWrapper::NodeCopyString(JsonNode node) const
+    {
+        constexpr const char* errorMessage = "Failed to get String value.";
+
+        std::string_view value;
+        if (!NodeRawString(node, value))
+        {
+            Check(NodeDocument(node, errorMessage).get_string().get(value), errorMessage, _rewindable);
+        }
+
+        return std::string{value};
+    }
+
+    template<typename TValue>
+    JsonErrorCode SimdJsonWrapper::NodeTryTo(JsonNode node, TValue& value) const
+    {
+        const simdjson::error_code error = NodeDocument(node, "Failed to read JSON value.").get(value);
+        if (simdjson::SUCCESS != error && IsRoot(node))
+        {
+            _rewindable = IsRecoverable(error);
+        }
+
+        return ToErrorCode(error);
+    }
+
+    template<typename TNumber>
+    std::size_t SimdJsonWrapper::NodeToNumbers(JsonNode node,
+                                               TNumber* values,
+                                               std::size_t capacity,
+                                               const char* errorMessage) const
+    {
+        simdjson::ondemand::array array;
+        Check(NodeDocument(node, errorMessage).get_array().get(array), errorMessage, _rewindable);
+
+        std::size_t count = 0;
+        for (auto result : array)
+        {
+            if (count == capacity)
+            {
+                throw XJsonError{errorMessage};
+            }
+
+            simdjson::ondemand::value element;
+            simdjson::error_code error = std::move(result).get(element);
+            if (simdjson::SUCCESS == error)
+            {
+                error = element.get(values[count++]);
+            }
+            Check(error, errorMessage, _rewindable);
+        }
+
+        return count;
+    }
+
+    void SimdJsonWrapper::SetMember(std::string_view key, std::string_view rawValue)
+    {
+        const bool isObject = NodeIsObject(RootNode());
+        if (!isObject && !NodeIsNull(RootNode()))
+        {
+            throw XJsonError{"Cannot set a member on a JSON value that is not an object."};
+        }
+
+        if (isObject)
+        {
+            // the last of repeated keys is the one read and serialized, so only its value is replaced
+            const JsonNode existing = KeyNode(key);
+            if (nullptr != existing.data)
+            {
+                const std::size_t position = static_cast<std::size_t>(static_cast<const char*>(existing.data) - _text);
+                EditText(position, existing.size, rawValue);
+
+                for (KeyEntry& entry : _keyIndex)
+                {
+                    if (_text + position == entry.value.data)
+                    {
+                        entry.value.size = rawValue.size();
+                    }
+                }
+                return;
+            }
+        }
+        else
+        {
+            EditText(0, _length, "{}");
+            _keyIndex.clear();
+            _unescapedKeys.clear();
+            _keysIndexed = true;
+        }
+
+        // a new member goes right before the closing brace, so the members already indexed stay where they are
+        const std::size_t position = Text().find_last_not_of(" \t\n\r");
+        const bool first = '{' == _text[Text().find_last_not_of(" \t\n\r", position - 1)];
+
+        std::string member{first ? "" : ","};
+        const std::size_t keyPosition = member.size() + 1;
+        Details::AppendString(member, key);
+        const bool escaped = member.size() - keyPosition - 1 != key.size();
+        member.push_back(':');
+        const std::size_t valuePosition = member.size();
+        member.append(rawValue);
+
+        EditText(position, 0, member);
+
+        const std::size_t hash = std::hash<std::string_view>{}(key);
+        const KeyEntry entry{hash,
+                             escaped ? std::string_view{_unescapedKeys.emplace_back(key)}
+                                     : std::string_view{_text + position + keyPosition, key.size()},
+                             JsonNode{_text + position + valuePosition, rawValue.size()}};
+        _keyIndex.insert(std::upper_bound(_keyIndex.begin(),
+                                          _keyIndex.end(),
+                                          hash,
+                                          [](std::size_t keyHash, const KeyEntry& candidate) {
+                                              return keyHash < candidate.hash;
+                                          }),
+                         entry);
+    }
+
+    void SimdJsonWrapper::EditText(std::size_t position, std::size_t removed, std::string_view inserted)
+    {
+        const char* previous = _text;
+        const std::size_t previousLength = _length;
+
+        if (_buffer.data() != _text)
+        {
+            // a mapped file is read-only, so the text moves to the buffer on the first edit
+            _buffer.assign(_text, _length);
+            _buffer.append(simdjson::SIMDJSON_PADDING, ' ');
+        }
+        _buffer.replace(position, removed, inserted);
+
+        _text = _buffer.data();
+        _length = previousLength - removed + inserted.size();
+        _capacity = _buffer.size();
+        _mappedFile = Details::MappedFile{};
+
+        // members after the edit are shifted, and all of them move if the buffer grew
+        const auto rebase = [&](const void* pointer) {
+            const char* text = static_cast<const char*>(pointer);
+            const std::less<const char*> before;
+            if (before(text, previous) || !before(text, previous + previousLength))
+            {
+                return text;
+            }
+
+            std::size_t offset = static_cast<std::size_t>(text - previous);
+            if (offset >= position + removed)
+            {
+                offset = offset - removed + inserted.size();
+            }
+            return _text + offset;
+        };
+
+        for (KeyEntry& entry : _keyIndex)
+        {
+            entry.key = std::string_view{rebase(entry.key.data()), entry.key.size()};
+            entry.value.data = rebase(entry.value.data);
+        }
+
+        // the iterators still point into the previous text; stage 1 runs again on the next whole-document read
+        _rewindable = false;
+        ForgetNodes();
+    }
+
+    void SimdJsonWrapper::ForgetNodes() const
+    {
+        for (Parsers::NodeSlot& slot : _parsers->nodeSlots)
+        {
+            slot.node = JsonNode{};
+            slot.lastUse = 0;
+        }
+        _parsers->nodeClock = 0;
+        _elementsOf = JsonNode{};
+        _elements.clear();
+        _unescapedStrings.clear();
+    }
+
+    std::string_view SimdJsonWrapper::Text() const
+    {
+        return std::string_view{_text, _length};
+    }
+
+}  // namespace Wrappers
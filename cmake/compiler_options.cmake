@@ -70,9 +70,9 @@ if ( CMAKE_BUILD_TYPE STREQUAL "Debug" )
   list(APPEND GCC_WARNINGS -O0)  # no optimisation
 elseif ( CMAKE_BUILD_TYPE STREQUAL "RelWithDebInfo" )
   list(APPEND CLANG_WARNINGS -g)
-  list(APPEND CLANG_WARNINGS -02)
+  list(APPEND CLANG_WARNINGS -O2)
 elseif ( CMAKE_BUILD_TYPE STREQUAL "Release" )
-  list(APPEND CLANG_WARNINGS -03)
+  list(APPEND CLANG_WARNINGS -O3)
 endif()
 
 # depending on compoiler, select whether to use clang warnings or gcc warnings